@@ -1,10 +1,12 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <algorithm>
 #include <math.h>
 #include <cmath>
 #include <ctime>
+#include <climits>
 
 using namespace std;
 
@@ -16,6 +18,11 @@ struct Node {
     Node(int x, int y) : x(x), y(y), g(0), h(0), f(0), parent(nullptr) {}
 };
 
+// 경로의 좌표 (값으로 저장)
+struct Point {
+    int x, y;
+};
+
 struct CompareNode {
     bool operator()(Node* a, Node* b) {
         return a->f > b->f;
@@ -31,14 +38,21 @@ int heuristic(int x1, int y1, int x2, int y2) {
 }
 
 // A* 알고리즘
-bool aStarAlgorithm(vector<vector<int>>& maze, Node* start, Node* goal, vector<Node*>& path) {
+// 탐색 중 만든 노드는 nodes 한 곳에 모아 두고 함수가 끝날 때 한 번에 해제함. (deque는 추가해도 기존 노드 주소가 바뀌지 않음)
+// 경로는 좌표 값으로 path에 저장하므로 호출한 쪽에서 해제할 것이 없음.
+bool aStarAlgorithm(vector<vector<int>>& maze, Point start_point, Point goal, vector<Point>& path) {
+    deque<Node> nodes;
+    Node* start = &nodes.emplace_back(start_point.x, start_point.y);
 
     priority_queue<Node*, vector<Node*>, CompareNode> openSet;
     vector<vector<bool>> closedSet(maze.size(), vector<bool>(maze[0].size(), false));
+    // 셀별로 지금까지 찾은 최소 g. 이보다 작을 때만 openSet에 추가함.
+    vector<vector<int>> bestG(maze.size(), vector<int>(maze[0].size(), INT_MAX));
 
     //초기 값
-    start->h = heuristic(start->x, start->y, goal->x, goal->y);
+    start->h = heuristic(start->x, start->y, goal.x, goal.y);
     start->f = start->g + start->h;
+    bestG[start->x][start->y] = start->g;
     openSet.push(start);
 
     while (!openSet.empty()) {
@@ -47,11 +61,14 @@ bool aStarAlgorithm(vector<vector<int>>& maze, Node* start, Node* goal, vector<N
         Node* current = openSet.top();
         openSet.pop();
 
+        // 이미 확장한 셀이면 건너뜀. (더 작은 g로 다시 추가된 셀의 이전 항목)
+        if (closedSet[current->x][current->y]) continue;
+
         // 목표 도달 시
-        if (current->x == goal->x && current->y == goal->y) {
+        if (current->x == goal.x && current->y == goal.y) {
             // current가 가장 처음 주소인 nullptr이 될때 까지 반복.
             while (current != nullptr) {
-                path.push_back(current);
+                path.push_back({current->x, current->y});
                 // pushback이후 current의 이전값인 parent를 가리킴.
                 current = current->parent;
             }
@@ -74,10 +91,13 @@ bool aStarAlgorithm(vector<vector<int>>& maze, Node* start, Node* goal, vector<N
             // maze범위 내에 존재하는 유효한 좌표인지 탐색, !closedset에서 false일 경우에 참.
             if (nx >= 0 && nx < maze.size() && ny >= 0 && ny < maze[0].size() && maze[nx][ny] == 0 && !closedSet[nx][ny]) {
                 int new_g = current->g + 1;
-                int new_h = heuristic(nx, ny, goal->x, goal->y);
+                // 이미 같거나 더 작은 g로 추가된 셀이면 건너뜀.
+                if (new_g >= bestG[nx][ny]) continue;
+                bestG[nx][ny] = new_g;
+                int new_h = heuristic(nx, ny, goal.x, goal.y);
                 int new_f = new_g + new_h;
 
-                Node* neighbor = new Node(nx, ny);
+                Node* neighbor = &nodes.emplace_back(nx, ny);
             
                 neighbor->g = new_g;
                 neighbor->h = new_h;
@@ -125,17 +145,17 @@ int main() {
     // 결과 경로 출력용 벡터 (O: 미방문 노드, X: 방문한 노드, . : 경로)
     vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
 
-    Node* start = new Node(0, 0);
-    Node* goal = new Node(maze.size()-1, maze[0].size()-1);
+    Point start = {0, 0};
+    Point goal = {(int)maze.size()-1, (int)maze[0].size()-1};
 
-    vector<Node*> path;
+    vector<Point> path;
 
     if (aStarAlgorithm(maze, start, goal, path)) {
         cout << "Astar Path found!" << endl;
         cout << "Path Cost:" << path.size() << endl;
         
-        for (Node* n : path) {
-            res_map[n->x][n->y] = '.';
+        for (Point p : path) {
+            res_map[p.x][p.y] = '.';
         }
 
         for(auto row : res_map){
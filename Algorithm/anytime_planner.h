@@ -0,0 +1,339 @@
+#ifndef ANYTIME_PLANNER_H
+#define ANYTIME_PLANNER_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+
+#include "grid_map.h"
+#include "grid_policy.h"
+#include "grid_path.h"
+#include "component_map.h"
+#include "heuristic.h"
+
+// 탐색 제한 (시간 / 확장 수). 둘 중 먼저 도달한 쪽에서 멈춤
+struct SearchBudget {
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    int max_expansions = INT_MAX;
+
+    // 지금부터 us 마이크로초 후까지
+    static SearchBudget within(std::chrono::microseconds us, int max_expansions = INT_MAX) {
+        return {std::chrono::steady_clock::now() + us, max_expansions};
+    }
+
+    static SearchBudget expansions(int max_expansions) {
+        SearchBudget budget;
+        budget.max_expansions = max_expansions;
+        return budget;
+    }
+};
+
+// 가중 A* / Anytime Repairing A* (ARA*)
+// 가중 A*: f = g + w * h (w >= 1). 휴리스틱을 크게 믿으므로 확장 수가 크게 줄고, 경로 비용은 최적의 w배 이하.
+// ARA*: 큰 w로 첫 경로를 빨리 찾은 뒤, w를 줄여 가며 경로를 개선함. 이전 반복의 g 값을 그대로 재사용하고,
+//   이번 반복에서 이미 확장한 셀의 g가 줄어들면 다시 열지 않고 INCONS 목록에 모아 두었다가 다음 반복에서 openset에 넣음.
+//   -> 반복마다 처음부터 탐색하는 것보다 훨씬 적게 확장함.
+// 제한 (SearchBudget)에 도달하면 마지막으로 완성한 경로와 그 경로의 준최적 상한 bound()를 반환함.
+//   bound(): 경로 비용 <= bound() * 최적 비용. min(w, 경로 비용 / openset과 INCONS의 최소 g + h)로 계산하므로 w보다 작을 수 있음.
+//   bound()가 1이면 최적 경로.
+// 우선순위는 정수 g + floor(w * h). 버림은 f를 줄이는 방향이므로 상한은 그대로 성립.
+template <class Neighborhood = FourConnected, class CostModel = UniformCost>
+class BasicAnytimePlanner {
+public:
+    BasicAnytimePlanner() = default;
+
+    explicit BasicAnytimePlanner(const GridMap& map) {
+        bind(map);
+    }
+
+    // 지도 연결. 크기가 바뀔 때만 버퍼를 다시 할당함.
+    void bind(const GridMap& map) {
+        map_ = &map;
+        int cells = map.cellCount();
+        if (cells != (int)g_.size()) {
+            g_.assign(cells, INT_MAX);
+            h_.assign(cells, 0);
+            parent_.assign(cells, -1);
+            seen_.assign(cells, 0);
+            closed_.assign(cells, 0);
+            incons_.assign(cells, 0);
+            generation_ = 0;
+            iteration_ = 0;
+        }
+        stride_ = map.stride();
+        for (int i = 0; i < Neighborhood::kCount; i++) {
+            offsets_[i] = Neighborhood::kDirections[i][0] * stride_ + Neighborhood::kDirections[i][1];
+        }
+    }
+
+    // 연결 요소 레이블 연결 (BasicGridPlanner::setComponents와 같음). 다른 영역이면 탐색하지 않고 false
+    void setComponents(const ComponentMap* components) { components_ = components; }
+
+    // 가중 A* (한 번만 탐색). 경로 비용 <= weight * 최적 비용.
+    // path: std::vector<Point> 또는 GridPath. 제한 안에 경로를 찾지 못하면 false.
+    template <class Heuristic = typename Neighborhood::DefaultHeuristic, class Path>
+    bool weightedAStar(Point start, Point goal, Path& path, double weight, Heuristic heuristic = Heuristic(),
+                       const SearchBudget& budget = SearchBudget()) {
+        return search(start, goal, path, heuristic, budget, weight, 0.0);
+    }
+
+    // ARA*. initial_weight로 시작해서 반복마다 weight_step씩 줄여 w = 1 (최적)까지 개선.
+    // 제한에 도달하면 그때까지 찾은 가장 좋은 경로를 path에 남기고 true. 첫 경로도 찾지 못했으면 false.
+    template <class Heuristic = typename Neighborhood::DefaultHeuristic, class Path>
+    bool anytimeAStar(Point start, Point goal, Path& path, const SearchBudget& budget, Heuristic heuristic = Heuristic(),
+                      double initial_weight = 3.0, double weight_step = 0.5) {
+        return search(start, goal, path, heuristic, budget, initial_weight, weight_step);
+    }
+
+    // 마지막 탐색이 반환한 경로의 준최적 상한 (경로 비용 <= bound() * 최적 비용)
+    double bound() const { return bound_; }
+
+    // 마지막 탐색이 반환한 경로의 비용
+    int pathCost() const { return path_cost_; }
+
+    // 마지막 탐색에서 확장한 셀 수 (모든 반복의 합)
+    int visitCount() const { return visit_cnt_; }
+
+    // 마지막 탐색에서 완성한 반복 (경로를 찾은 w) 수
+    int iterationCount() const { return iteration_cnt_; }
+
+    // 마지막 탐색이 제한 때문에 멈췄는지
+    bool budgetExhausted() const { return exhausted_; }
+
+private:
+    template <class Heuristic, class Path>
+    bool search(Point start, Point goal, Path& path, const Heuristic& heuristic, const SearchBudget& budget, double weight,
+                double weight_step) {
+        beginSearch();
+        path.clear();
+        if (!map_->isFree(start.x, start.y) || !map_->isFree(goal.x, goal.y)) return false;
+        if (components_ && !components_->connected(map_->index(start.x, start.y), map_->index(goal.x, goal.y))) return false;
+        if (weight < 1.0) weight = 1.0;
+
+        goal_ = goal;
+        goal_idx_ = map_->index(goal.x, goal.y);
+        const int start_idx = map_->index(start.x, start.y);
+        touch(goal_idx_, heuristic);
+        touch(start_idx, heuristic);
+        g_[start_idx] = 0;
+        open_.push_back({priority(start_idx, weight), start_idx});
+
+        bool found = false;
+        while (true) {
+            if (!improvePath(weight, heuristic, budget)) break;   // 제한 도달 (이번 반복의 경로는 미완성)
+            if (g_[goal_idx_] == INT_MAX) break;                    // 경로 없음
+            found = true;
+            iteration_cnt_++;
+
+            // 이번 w의 경로와 상한 기록
+            // 목표의 g는 확장이 끝난 조상의 g가 나중에 줄어도 (INCONS) 갱신되지 않으므로, 비용은 실제 경로에서 계산
+            path_cost_ = buildPath(path);
+            bound_ = std::min(weight, suboptimality());
+            if (bound_ <= 1.0 || weight_step <= 0.0) break;
+
+            // 다음 반복: w를 줄이고 INCONS를 openset에 합친 뒤, 새 w로 우선순위를 다시 계산
+            weight = std::max(1.0, weight - weight_step);
+            nextIteration(weight);
+        }
+        return found;
+    }
+
+    // 현재 w로 openset의 최소 f가 목표의 g 이상이 될 때까지 확장. 제한에 도달하면 false
+    template <class Heuristic>
+    bool improvePath(double weight, const Heuristic& heuristic, const SearchBudget& budget) {
+        while (!open_.empty() && g_[goal_idx_] > open_.front().first) {
+            if (visit_cnt_ >= budget.max_expansions ||
+                ((visit_cnt_ & 63) == 0 && std::chrono::steady_clock::now() >= budget.deadline)) {
+                exhausted_ = true;
+                return false;
+            }
+
+            std::pop_heap(open_.begin(), open_.end(), Compare());
+            const int current = open_.back().second;
+            open_.pop_back();
+
+            // 이번 반복에서 이미 확장한 셀 (더 작은 g로 다시 push된 셀의 이전 항목)
+            if (closed_[current] == iteration_) continue;
+            closed_[current] = iteration_;
+            visit_cnt_++;
+
+            forEachMove(current, [&](int next, int move_cost) {
+                int new_g = g_[current] + move_cost;
+                touch(next, heuristic);
+                if (new_g >= g_[next]) return;
+                g_[next] = new_g;
+                parent_[next] = current;
+
+                if (closed_[next] != iteration_) {
+                    open_.push_back({priority(next, weight), next});
+                    std::push_heap(open_.begin(), open_.end(), Compare());
+                } else if (incons_[next] != iteration_) {
+                    // 이번 반복에서는 다시 열지 않음 (ARA*)
+                    incons_[next] = iteration_;
+                    incons_list_.push_back(next);
+                }
+            });
+        }
+        return true;
+    }
+
+    // 경로 비용 / (openset과 INCONS의 최소 g + h). 남은 셀 중 어느 것을 거쳐도 이보다 싼 경로는 없음
+    double suboptimality() const {
+        long long lower = path_cost_;
+        for (const auto& entry : open_) {
+            if (closed_[entry.second] != iteration_) lower = std::min(lower, (long long)g_[entry.second] + h_[entry.second]);
+        }
+        for (int idx : incons_list_) lower = std::min(lower, (long long)g_[idx] + h_[idx]);
+        return lower > 0 ? (double)path_cost_ / lower : 1.0;
+    }
+
+    void nextIteration(double weight) {
+        const uint32_t previous = iteration_;
+        if (++iteration_ == 0) {
+            std::fill(closed_.begin(), closed_.end(), 0);
+            std::fill(incons_.begin(), incons_.end(), 0);
+            iteration_ = 1;
+        }
+
+        // openset (이전 반복에서 확장하지 않은 셀) + INCONS, 셀마다 하나씩 새 우선순위로
+        rebuild_.clear();
+        for (const auto& entry : open_) {
+            int idx = entry.second;
+            if (closed_[idx] == previous || incons_[idx] == iteration_) continue;
+            incons_[idx] = iteration_;   // 중복 제거용 (아래에서 다시 지움)
+            rebuild_.push_back(idx);
+        }
+        for (int idx : incons_list_) {
+            if (incons_[idx] == iteration_) continue;
+            incons_[idx] = iteration_;
+            rebuild_.push_back(idx);
+        }
+        incons_list_.clear();
+
+        open_.clear();
+        for (int idx : rebuild_) {
+            incons_[idx] = 0;
+            open_.push_back({priority(idx, weight), idx});
+        }
+        std::make_heap(open_.begin(), open_.end(), Compare());
+    }
+
+    // 처음 보는 셀이면 g, parent, h 초기화
+    template <class Heuristic>
+    void touch(int idx, const Heuristic& heuristic) {
+        if (seen_[idx] == generation_) return;
+        seen_[idx] = generation_;
+        g_[idx] = INT_MAX;
+        parent_[idx] = -1;
+        h_[idx] = heuristic(map_->row(idx), map_->col(idx), goal_.x, goal_.y);
+    }
+
+    int priority(int idx, double weight) const {
+        return g_[idx] + (int)(weight * h_[idx]);
+    }
+
+    template <class F>
+    void forEachMove(int current, F&& f) const {
+        forEachDirection<Neighborhood>([&](auto dir) {
+            constexpr int i = decltype(dir)::value;
+            const int next = current + offsets_[i];
+            if (!map_->isFree(next)) return;
+            if constexpr (isDiagonal<Neighborhood, i>()) {
+                // 대각선: 양옆 셀이 모두 비어 있어야 함 (모서리 통과 금지)
+                if (!map_->isFree(current + Neighborhood::kDirections[i][0] * stride_) ||
+                    !map_->isFree(current + Neighborhood::kDirections[i][1])) return;
+            }
+            f(next, CostModel::cost(*map_, next, stepCost<Neighborhood, i>()));
+        });
+    }
+
+    void beginSearch() {
+        if (++generation_ == 0) {
+            std::fill(seen_.begin(), seen_.end(), 0);
+            generation_ = 1;
+        }
+        if (++iteration_ == 0) {
+            std::fill(closed_.begin(), closed_.end(), 0);
+            std::fill(incons_.begin(), incons_.end(), 0);
+            iteration_ = 1;
+        }
+        open_.clear();
+        incons_list_.clear();
+        visit_cnt_ = 0;
+        iteration_cnt_ = 0;
+        path_cost_ = 0;
+        bound_ = 0;
+        exhausted_ = false;
+    }
+
+    // parent를 따라 경로를 만들고 (GridPlanner::buildPath와 같은 방식) 경로의 이동 비용 합을 반환
+    template <class Path>
+    int buildPath(Path& path) const {
+        int length = 0, cost = 0;
+        for (int idx = goal_idx_; idx != -1; idx = parent_[idx]) length++;
+        resizePath(path, length);
+        for (int idx = goal_idx_; idx != -1; idx = parent_[idx]) {
+            storeCell(path, --length, idx);
+            if (parent_[idx] != -1) cost += moveCost(parent_[idx], idx);
+        }
+        return cost;
+    }
+
+    // 이웃한 두 셀 사이의 이동 비용 (forEachMove와 같은 값)
+    int moveCost(int from, int to) const {
+        const bool diagonal = map_->row(from) != map_->row(to) && map_->col(from) != map_->col(to);
+        return CostModel::cost(*map_, to, diagonal ? Neighborhood::kDiagonalCost : Neighborhood::kStraightCost);
+    }
+
+    void resizePath(std::vector<Point>& path, int length) const { path.resize(length); }
+    void resizePath(GridPath& path, int length) const { path.resize(length, stride_); }
+    void storeCell(std::vector<Point>& path, int i, int idx) const { path[i] = map_->toPoint(idx); }
+    void storeCell(GridPath& path, int i, int idx) const { path.cells_[i] = idx; }
+
+    // {priority, idx} min heap. 반복이 바뀔 때 전체를 다시 계산해야 하므로 HeapOpenList 대신 직접 관리
+    struct Compare {
+        bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const {
+            return a.first > b.first;
+        }
+    };
+
+    const GridMap* map_ = nullptr;
+    int stride_ = 0;
+    int offsets_[Neighborhood::kCount] = {};
+    const ComponentMap* components_ = nullptr;
+
+    std::vector<int> g_;
+    std::vector<int> h_;              // 셀 -> 목표 휴리스틱 (w가 바뀔 때 다시 계산하지 않도록 저장)
+    std::vector<int> parent_;
+    std::vector<uint32_t> seen_;      // 이번 탐색에서 초기화한 셀 (세대 번호)
+    std::vector<uint32_t> closed_;    // 이번 반복에서 확장한 셀 (반복 번호)
+    std::vector<uint32_t> incons_;    // 이번 반복의 INCONS 목록에 있는 셀 (반복 번호)
+    uint32_t generation_ = 0;
+    uint32_t iteration_ = 0;
+
+    std::vector<std::pair<int, int>> open_;
+    std::vector<int> incons_list_;
+    std::vector<int> rebuild_;
+
+    Point goal_ = {0, 0};
+    int goal_idx_ = -1;
+    int visit_cnt_ = 0;
+    int iteration_cnt_ = 0;
+    int path_cost_ = 0;
+    double bound_ = 0;
+    bool exhausted_ = false;
+};
+
+// 4방향, 이동 비용 1
+using AnytimePlanner = BasicAnytimePlanner<FourConnected, UniformCost>;
+
+// 8방향 (직선 10, 대각선 14)
+using AnytimePlanner8 = BasicAnytimePlanner<EightConnected, UniformCost>;
+
+// 셀 비용 (GridMap::setCost) 적용
+using WeightedAnytimePlanner = BasicAnytimePlanner<FourConnected, WeightedCost>;
+
+#endif
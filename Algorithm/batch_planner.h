@@ -0,0 +1,140 @@
+#ifndef BATCH_PLANNER_H
+#define BATCH_PLANNER_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+#include "grid_map.h"
+#include "grid_planner.h"
+#include "grid_path.h"
+
+// 경로 탐색 요청 하나
+struct PlanQuery {
+    Point start;
+    Point goal;
+};
+
+// 경로 탐색 결과 하나
+struct PlanResult {
+    bool found = false;
+    GridPath path;   // 셀 인덱스 경로 (grid_path.h). 결과를 재사용하면 탐색마다 할당 없음
+    int visit_cnt = 0;
+};
+
+// 여러 시점/종점 쌍을 스레드 풀에서 나누어 탐색하는 플래너
+// 지도는 모든 스레드가 읽기 전용으로 공유하고, 탐색 버퍼(GridPlanner)는 스레드마다 따로 가짐.
+// 스레드는 생성자에서 한 번만 만들고 planBatch() 호출마다 재사용함. 호출한 스레드도 함께 탐색에 참여.
+// 각 스레드는 공유 카운터에서 다음 요청 번호를 하나씩 가져가므로 요청마다 탐색 시간이 달라도 부하가 고르게 나뉨.
+//
+// 빌드 시 -pthread 필요 (g++ -std=c++17 -O2 -pthread ...)
+class BatchPlanner {
+public:
+    // threads: 사용할 스레드 수 (호출 스레드 포함). 0이면 하드웨어 스레드 수
+    explicit BatchPlanner(const GridMap& map, int threads = 0) {
+        if (threads <= 0) threads = std::thread::hardware_concurrency();
+        if (threads <= 0) threads = 1;
+        for (int i = 0; i < threads; i++) {
+            planners_.emplace_back(map);
+        }
+        for (int i = 1; i < threads; i++) {
+            workers_.emplace_back([this, i]() { workerLoop(i); });
+        }
+    }
+
+    ~BatchPlanner() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_cv_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    BatchPlanner(const BatchPlanner&) = delete;
+    BatchPlanner& operator=(const BatchPlanner&) = delete;
+
+    int threadCount() const { return planners_.size(); }
+
+    // 모든 요청을 A*로 탐색. results[i]는 queries[i]의 결과.
+    // results를 호출 간에 재사용하면 path의 capacity도 재사용됨.
+    template <class Heuristic = ManhattanHeuristic>
+    void planBatch(const std::vector<PlanQuery>& queries, std::vector<PlanResult>& results, Heuristic heuristic = Heuristic()) {
+        results.resize(queries.size());
+        run(queries.size(), [&](GridPlanner& planner, size_t i) {
+            PlanResult& result = results[i];
+            result.found = planner.aStarAlgorithm(queries[i].start, queries[i].goal, result.path, heuristic);
+            result.visit_cnt = planner.visitCount();
+        });
+    }
+
+private:
+    using Task = std::function<void(GridPlanner&, size_t)>;
+
+    // task를 0 ~ count-1 번 요청에 대해 모든 스레드에서 나누어 실행하고, 끝날 때까지 기다림.
+    void run(size_t count, const Task& task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            task_count_ = count;
+            next_.store(0);
+            active_ = workers_.size();
+            epoch_++;
+        }
+        start_cv_.notify_all();
+
+        work(planners_[0]);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return active_ == 0; });
+        task_ = nullptr;
+    }
+
+    // 공유 카운터에서 요청 번호를 가져와 처리. 남은 요청이 없으면 반환.
+    void work(GridPlanner& planner) {
+        while (true) {
+            size_t i = next_.fetch_add(1);
+            if (i >= task_count_) return;
+            (*task_)(planner, i);
+        }
+    }
+
+    void workerLoop(int id) {
+        uint64_t seen_epoch = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_cv_.wait(lock, [&]() { return stop_ || epoch_ != seen_epoch; });
+                if (stop_) return;
+                seen_epoch = epoch_;
+            }
+
+            work(planners_[id]);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                active_--;
+            }
+            done_cv_.notify_one();
+        }
+    }
+
+    std::vector<GridPlanner> planners_;   // 스레드별 탐색 버퍼. 0번은 호출 스레드용
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable start_cv_, done_cv_;
+    const Task* task_ = nullptr;
+    size_t task_count_ = 0;
+    std::atomic<size_t> next_{0};
+    int active_ = 0;                      // 아직 작업 중인 worker 수
+    uint64_t epoch_ = 0;                  // planBatch 호출 번호. worker가 새 작업을 구분하는 데 사용
+    bool stop_ = false;
+};
+
+#endif
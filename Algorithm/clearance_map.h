@@ -0,0 +1,166 @@
+#ifndef CLEARANCE_MAP_H
+#define CLEARANCE_MAP_H
+
+#include <vector>
+#include <thread>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+#include "grid_map.h"
+
+// 장애물 여유 거리 (clearance) 지도
+// 모든 셀에 대해 가장 가까운 장애물 셀까지의 유클리디안 거리 제곱 (셀 중심 기준, 정수)을 한 번에 계산해 둠.
+// 로봇 반지름 r이 셀에 들어가는지는 "거리 제곱 > r²" 비교 한 번 (isClear)이고,
+// inflate()로 r 안에 장애물이 있는 셀을 막은 지도를 만들면 기존 플래너를 그대로 사용할 수 있음.
+//
+// 거리 변환은 선형 시간 (Meijster): 1단계 열마다 위아래 가장 가까운 장애물까지의 거리,
+// 2단계 행마다 포물선 f(q) = (y - q)² + g(q)²의 하한 (lower envelope). 두 단계 모두 셀당 O(1).
+// 1단계는 열 범위, 2단계는 행 범위로 나누어 스레드마다 처리함. (빌드 시 -pthread 필요)
+// 지도 테두리 (지도 밖)도 장애물로 취급함. 셀을 바꾼 뒤에는 update()를 다시 호출해야 함.
+class ClearanceMap {
+public:
+    ClearanceMap() = default;
+
+    explicit ClearanceMap(const GridMap& map, int threads = 1) {
+        update(map, threads);
+    }
+
+    // threads: 사용할 스레드 수 (호출 스레드 포함). 0이면 하드웨어 스레드 수
+    void update(const GridMap& map, int threads = 1) {
+        map_ = &map;
+        rows_ = map.rows() + 2;   // 테두리 포함
+        stride_ = map.stride();
+        dist2_.resize(map.cellCount());
+        if (threads <= 0) threads = std::thread::hardware_concurrency();
+        if (threads <= 0) threads = 1;
+
+        // 1단계: 열 방향 거리 g (dist2_에 임시 저장)
+        parallelFor(stride_, threads, [&](int y0, int y1) { columnPass(y0, y1); });
+        // 2단계: 행마다 g² 포물선의 하한 -> 거리 제곱. 테두리 행은 모두 장애물 (0)
+        parallelFor(rows_ - 2, threads, [&](int x0, int x1) {
+            std::vector<int> site(stride_), start(stride_);
+            std::vector<int> row(stride_);
+            for (int x = x0 + 1; x < x1 + 1; x++) rowPass(x, site.data(), start.data(), row.data());
+        });
+        for (int y = 0; y < stride_; y++) {
+            dist2_[y] = 0;
+            dist2_[(rows_ - 1) * stride_ + y] = 0;
+        }
+    }
+
+    int rows() const { return rows_ - 2; }
+    int cols() const { return stride_ - 2; }
+
+    // 가장 가까운 장애물까지 거리의 제곱 (셀 단위). 장애물 셀은 0
+    int squaredClearance(int idx) const { return dist2_[idx]; }
+    int squaredClearance(int x, int y) const { return dist2_[(x + 1) * stride_ + (y + 1)]; }
+
+    // 가장 가까운 장애물까지 거리 (셀 단위)
+    double clearance(int x, int y) const { return std::sqrt((double)squaredClearance(x, y)); }
+
+    // 반지름 radius (셀 단위)의 원 안에 장애물 셀 중심이 없으면 true. radius 0이면 이동 가능 셀과 같음.
+    bool isClear(int idx, double radius) const { return dist2_[idx] > threshold(radius); }
+    bool isClear(int x, int y, double radius) const {
+        return x >= 0 && x < rows() && y >= 0 && y < cols() && isClear((x + 1) * stride_ + (y + 1), radius);
+    }
+
+    // 반지름 radius 로봇의 계획용 지도. radius 안에 장애물이 있는 셀을 막고, 셀 비용은 원래 지도에서 복사함.
+    // out은 새로 할당한 지도로 바뀜. (외부 메모리를 가리키는 지도에 덮어쓰지 않음)
+    void inflate(double radius, GridMap& out) const {
+        const int limit = threshold(radius);
+        out = GridMap(rows(), cols());
+        for (int x = 0; x < rows(); x++) {
+            for (int y = 0; y < cols(); y++) {
+                int idx = (x + 1) * stride_ + (y + 1);
+                if (dist2_[idx] <= limit) out.setBlocked(x, y, true);
+                if (map_->costData()) out.setCost(x, y, map_->cost(idx));
+            }
+        }
+    }
+
+    // 거리 배열 크기 (byte)
+    size_t bytes() const { return dist2_.size() * sizeof(int); }
+
+private:
+    // r² 이하인 정수 거리 제곱은 막힘
+    static int threshold(double radius) { return radius <= 0 ? 0 : (int)std::floor(radius * radius); }
+
+    // [0, count)를 threads개 범위로 나누어 f(begin, end) 실행. 첫 범위는 호출 스레드가 처리
+    template <class F>
+    static void parallelFor(int count, int threads, F&& f) {
+        if (threads > count) threads = count > 0 ? count : 1;
+        std::vector<std::thread> workers;
+        for (int t = 1; t < threads; t++) {
+            workers.emplace_back([&f, t, threads, count]() {
+                f((long long)count * t / threads, (long long)count * (t + 1) / threads);
+            });
+        }
+        f(0, count / threads);
+        for (auto& worker : workers) worker.join();
+    }
+
+    // 열 y0 ~ y1 - 1: 위쪽, 아래쪽으로 한 번씩 훑어 같은 열의 가장 가까운 장애물까지 행 거리
+    // 첫 행과 마지막 행은 테두리 (장애물)이므로 거리는 항상 rows_ 이하
+    void columnPass(int y0, int y1) {
+        const uint8_t* cells = map_->data();
+        for (int y = y0; y < y1; y++) dist2_[y] = 0;
+        for (int x = 1; x < rows_; x++) {
+            const int base = x * stride_;
+            for (int y = y0; y < y1; y++) {
+                dist2_[base + y] = cells[base + y] == GridMap::kFree ? dist2_[base - stride_ + y] + 1 : 0;
+            }
+        }
+        for (int x = rows_ - 2; x >= 0; x--) {
+            const int base = x * stride_;
+            for (int y = y0; y < y1; y++) {
+                int below = dist2_[base + stride_ + y] + 1;
+                if (below < dist2_[base + y]) dist2_[base + y] = below;
+            }
+        }
+    }
+
+    // 행 x: g(q) (열 거리)로부터 거리 제곱 min_q (y - q)² + g(q)² 계산
+    // site[k]: 하한을 이루는 k번째 포물선의 열, start[k]: 그 포물선이 최소가 되는 구간의 시작 열
+    void rowPass(int x, int* site, int* start, int* g) {
+        int* out = dist2_.data() + x * stride_;
+        for (int y = 0; y < stride_; y++) g[y] = out[y];
+
+        auto f = [g](long long y, int q) { return (y - q) * (y - q) + (long long)g[q] * g[q]; };
+        // 포물선 q < u가 같아지는 마지막 열 (내림 나눗셈)
+        auto sep = [g](int q, int u) {
+            long long num = (long long)u * u - (long long)q * q + (long long)g[u] * g[u] - (long long)g[q] * g[q];
+            long long den = 2LL * (u - q);
+            return num >= 0 ? num / den : -((-num + den - 1) / den);
+        };
+
+        int k = 0;
+        site[0] = 0;
+        start[0] = 0;
+        for (int u = 1; u < stride_; u++) {
+            while (k >= 0 && f(start[k], site[k]) > f(start[k], u)) k--;
+            if (k < 0) {
+                k = 0;
+                site[0] = u;
+                start[0] = 0;
+            } else {
+                long long w = sep(site[k], u) + 1;
+                if (w < stride_) {
+                    k++;
+                    site[k] = u;
+                    start[k] = w;
+                }
+            }
+        }
+        for (int y = stride_ - 1; y >= 0; y--) {
+            out[y] = f(y, site[k]);
+            if (y == start[k]) k--;
+        }
+    }
+
+    const GridMap* map_ = nullptr;
+    int rows_ = 0, stride_ = 0;
+    std::vector<int> dist2_;   // GridMap과 같은 인덱스 (테두리 포함). 1단계 후에는 열 거리, 2단계 후에는 거리 제곱
+};
+
+#endif
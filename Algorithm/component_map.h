@@ -0,0 +1,273 @@
+#ifndef COMPONENT_MAP_H
+#define COMPONENT_MAP_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "grid_map.h"
+
+// 연결 요소 (connected component) 레이블 지도
+// 이동 가능한 셀마다 속한 연결 영역의 번호를 저장해 두면, 두 셀 사이에 경로가 있는지는 번호 비교 한 번 (O(1)).
+// 경로가 없는 요청은 플래너가 도달 가능한 영역 전체를 탐색한 뒤에야 실패하므로 (최악의 지연), 탐색 전에 거름.
+// (BasicGridPlanner::setComponents 참고)
+//
+// 상하좌우 4방향 연결 기준. 8방향 플래너도 대각선은 양옆 셀이 모두 비어 있을 때만 이동하므로 연결 영역이 같음.
+//
+// 셀을 바꾼 뒤 updateCells()에 바뀐 셀 목록을 넘기면 전체를 다시 계산하지 않고 고침.
+// - 막힌 셀이 열림: 이웃 영역을 하나로 합침. 가장 큰 영역의 번호를 남기고 작은 영역만 번호를 바꿈.
+// - 열린 셀이 막힘: 주변 8셀만 보고 이웃끼리 여전히 이어져 있으면 끝 (대부분의 경우).
+//   아니면 이웃마다 BFS를 번갈아 한 칸씩 진행해서, 다른 BFS와 만나지 못하고 먼저 끝난 (작은) 쪽만 새 번호를 붙임.
+//   -> 비용은 지도 크기가 아니라 갈라진 작은 영역의 크기에 비례.
+// version()은 build / updateCells 호출마다 1씩 증가함.
+class ComponentMap {
+public:
+    static constexpr uint32_t kNone = 0;   // 장애물 셀의 번호
+
+    ComponentMap() = default;
+
+    explicit ComponentMap(const GridMap& map) {
+        build(map);
+    }
+
+    // 전체 레이블 계산 (셀마다 한 번씩 방문하는 flood fill, O(셀 수))
+    // map은 이 객체보다 오래 살아 있어야 함. (복사하지 않고 참조만 보관)
+    void build(const GridMap& map) {
+        map_ = &map;
+        stride_ = map.stride();
+        offsets_[0] = 1;
+        offsets_[1] = stride_;
+        offsets_[2] = -1;
+        offsets_[3] = -stride_;
+        labels_.assign(map.cellCount(), kNone);
+        marks_.assign(map.cellCount(), 0);
+        stamp_ = 0;
+        sizes_.assign(1, 0);
+        unused_.clear();
+
+        for (int idx = 0; idx < map.cellCount(); idx++) {
+            if (!map.isFree(idx) || labels_[idx] != kNone) continue;
+            uint32_t label = newLabel();
+            sizes_[label] = relabel(idx, kNone, label);
+        }
+        version_++;
+    }
+
+    // changed 셀들이 바뀐 뒤 호출. 지도의 현재 값과 레이블을 비교하므로 실제로 바뀌지 않은 셀은 무시함.
+    void updateCells(const std::vector<Point>& changed) {
+        for (const Point& p : changed) {
+            if (!map_->inside(p.x, p.y)) continue;
+            int idx = map_->index(p.x, p.y);
+            bool free = map_->isFree(idx);
+            if (free && labels_[idx] == kNone) openCell(idx);
+            else if (!free && labels_[idx] != kNone) closeCell(idx);
+        }
+        version_++;
+    }
+
+    // 두 셀 사이에 경로가 있는지 (GridMap 인덱스). 어느 한쪽이 장애물이면 false
+    bool connected(int a, int b) const { return labels_[a] != kNone && labels_[a] == labels_[b]; }
+    bool connected(Point a, Point b) const {
+        return map_->isFree(a.x, a.y) && map_->isFree(b.x, b.y) &&
+               connected(map_->index(a.x, a.y), map_->index(b.x, b.y));
+    }
+
+    // 셀의 영역 번호 (장애물은 kNone). 번호는 갱신 후 바뀔 수 있으므로 같은 version 안에서만 비교해야 함.
+    uint32_t label(int idx) const { return labels_[idx]; }
+    uint32_t label(int x, int y) const { return labels_[map_->index(x, y)]; }
+
+    // 셀이 속한 영역의 셀 수
+    int componentSize(int idx) const { return sizes_[labels_[idx]]; }
+
+    // 현재 영역 수
+    int componentCount() const { return (int)sizes_.size() - 1 - (int)unused_.size(); }
+
+    uint64_t version() const { return version_; }
+
+private:
+    uint32_t newLabel() {
+        if (!unused_.empty()) {
+            uint32_t label = unused_.back();
+            unused_.pop_back();
+            return label;
+        }
+        sizes_.push_back(0);
+        return sizes_.size() - 1;
+    }
+
+    void releaseLabel(uint32_t label) {
+        sizes_[label] = 0;
+        unused_.push_back(label);
+    }
+
+    // start와 4방향으로 이어진 from 번호 셀을 모두 to로 바꾸고 셀 수 반환
+    // from이 kNone이면 (build) 이동 가능한 셀만. 갱신 중에는 지도 대신 레이블만 보므로, 아직 처리하지 않은 바뀐 셀은 이전 상태로 취급됨
+    int relabel(int start, uint32_t from, uint32_t to) {
+        stack_.clear();
+        stack_.push_back(start);
+        labels_[start] = to;
+        int count = 0;
+        while (!stack_.empty()) {
+            int current = stack_.back();
+            stack_.pop_back();
+            count++;
+            for (int offset : offsets_) {
+                int next = current + offset;
+                if (labels_[next] != from || (from == kNone && !map_->isFree(next))) continue;
+                labels_[next] = to;
+                stack_.push_back(next);
+            }
+        }
+        return count;
+    }
+
+    // 막힌 셀이 열림: 이웃 영역 중 가장 큰 영역에 나머지를 합침
+    void openCell(int idx) {
+        uint32_t best = kNone;
+        for (int offset : offsets_) {
+            uint32_t l = labels_[idx + offset];
+            if (l != kNone && (best == kNone || sizes_[l] > sizes_[best])) best = l;
+        }
+        if (best == kNone) {
+            best = newLabel();
+            labels_[idx] = best;
+            sizes_[best] = 1;
+            return;
+        }
+        labels_[idx] = best;
+        sizes_[best]++;
+        for (int offset : offsets_) {
+            uint32_t l = labels_[idx + offset];
+            if (l == kNone || l == best) continue;
+            sizes_[best] += relabel(idx + offset, l, best);
+            releaseLabel(l);
+        }
+    }
+
+    // 열린 셀이 막힘: 이웃들이 아직 이어져 있는지 확인하고, 떨어져 나간 영역에 새 번호를 붙임
+    void closeCell(int idx) {
+        const uint32_t label = labels_[idx];
+        labels_[idx] = kNone;
+        if (--sizes_[label] == 0) {
+            releaseLabel(label);
+            return;
+        }
+
+        // 주변 8셀을 시계 방향으로 돌면서, 연속해서 열린 셀 구간마다 상하좌우 이웃 하나씩 대표로 고름.
+        // 같은 구간의 셀은 서로 4방향으로 이어져 있으므로, 구간이 하나면 영역이 갈라지지 않음.
+        const int ring[8] = {-stride_, -stride_ + 1, 1, stride_ + 1, stride_, stride_ - 1, -1, -stride_ - 1};
+        int start = 0;
+        while (start < 8 && labels_[idx + ring[start]] != kNone) start++;
+        if (start == 8) return;   // 주변이 모두 열림 -> 이어져 있음
+
+        int seeds[4], seed_count = 0;
+        bool in_run = false;
+        for (int k = 1; k <= 8; k++) {
+            int i = (start + k) % 8;
+            int cell = idx + ring[i];
+            if (labels_[cell] == kNone) {
+                in_run = false;
+                continue;
+            }
+            // 구간의 첫 상하좌우 이웃 (짝수 번호)만 대표로 기록. 대각선 셀은 구간을 이어 주기만 함
+            if (i % 2 == 0 && !in_run) {
+                seeds[seed_count++] = cell;
+                in_run = true;
+            }
+        }
+        if (seed_count <= 1) return;
+        splitSearch(label, seeds, seed_count);
+    }
+
+    // 이웃 seed마다 BFS를 번갈아 한 칸씩 진행. 두 BFS가 만나면 한 그룹으로 합치고 (남은 큐도 합침),
+    // 다른 그룹과 만나지 못하고 큐가 빈 그룹은 떨어져 나간 영역이므로 새 번호를 붙임.
+    // 진행 중인 그룹이 하나만 남으면 그 그룹은 원래 번호를 유지하고 종료.
+    void splitSearch(uint32_t label, const int* seeds, int count) {
+        if (stamp_ > UINT32_MAX - 8) {
+            std::fill(marks_.begin(), marks_.end(), 0);
+            stamp_ = 0;
+        }
+        const uint32_t base = stamp_ + 1;
+        stamp_ += count;
+
+        int group[4], head[4];
+        for (int s = 0; s < count; s++) {
+            group[s] = s;
+            head[s] = 0;
+            queues_[s].clear();
+            queues_[s].push_back(seeds[s]);
+            marks_[seeds[s]] = base + s;
+        }
+        auto find = [&](int s) {
+            while (group[s] != s) s = group[s];
+            return s;
+        };
+
+        int active = count;
+        bool running[4] = {true, true, true, true};
+        while (active > 1) {
+            for (int s = 0; s < count && active > 1; s++) {
+                if (!running[s]) continue;
+                std::vector<int>& queue = queues_[s];
+                if (head[s] == (int)queue.size()) {
+                    // 다른 그룹과 만나지 않고 끝남: 이 그룹이 방문한 셀이 떨어져 나간 영역 전체
+                    uint32_t split = newLabel();
+                    int moved = 0;
+                    for (int t = 0; t < count; t++) {
+                        if (find(t) != s) continue;
+                        for (int cell : queues_[t]) {
+                            if (labels_[cell] != label) continue;
+                            labels_[cell] = split;
+                            moved++;
+                        }
+                    }
+                    sizes_[split] = moved;
+                    sizes_[label] -= moved;
+                    running[s] = false;
+                    active--;
+                    continue;
+                }
+
+                int current = queue[head[s]++];
+                for (int offset : offsets_) {
+                    int next = current + offset;
+                    if (labels_[next] != label) continue;
+                    uint32_t mark = marks_[next];
+                    if (mark < base || mark >= base + count) {
+                        marks_[next] = base + s;
+                        queue.push_back(next);
+                        continue;
+                    }
+                    int other = find(mark - base);
+                    if (other == s) continue;
+                    // 다른 그룹과 만남: other의 남은 큐를 이 그룹으로 옮기고 합침
+                    std::vector<int>& other_queue = queues_[other];
+                    queue.insert(queue.end(), other_queue.begin() + head[other], other_queue.end());
+                    head[other] = other_queue.size();
+                    group[other] = s;
+                    running[other] = false;
+                    active--;
+                    if (active == 1) break;
+                }
+            }
+        }
+    }
+
+    const GridMap* map_ = nullptr;
+    int stride_ = 0;
+    int offsets_[4] = {};
+
+    std::vector<uint32_t> labels_;   // GridMap과 같은 인덱스. 장애물 (테두리 포함)은 kNone
+    std::vector<int> sizes_;         // 번호별 셀 수 (sizes_[0]은 사용 안 함)
+    std::vector<uint32_t> unused_;   // 비어 있는 번호 (재사용)
+
+    // 갱신용 작업 버퍼
+    std::vector<int> stack_;
+    std::vector<int> queues_[4];
+    std::vector<uint32_t> marks_;    // splitSearch에서 셀을 방문한 BFS (stamp_ 기준)
+    uint32_t stamp_ = 0;
+
+    uint64_t version_ = 0;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef DISTANCE_FIELD_H
+#define DISTANCE_FIELD_H
+
+#include <vector>
+#include <climits>
+
+#include "grid_map.h"
+
+// 목표까지의 거리 지도 (cost-to-go)
+// 한 목표(예: 충전 스테이션)에 대해 다익스트라를 한 번 끝까지 돌려서 모든 셀의 목표까지 거리와 다음 이동 셀을 저장함.
+// 같은 목표로 가는 로봇들은 탐색 없이 현재 셀의 값을 읽어서 다음 이동 셀을 O(1)에 구할 수 있음.
+// 계산한 시점의 지도 상태를 기준으로 하므로, 지도가 바뀌면 다시 계산해야 함.
+// GridPlanner::distanceField() 또는 WavefrontPlanner::distanceField() (이동 비용 1, wavefront.h),
+// ParallelDistancePlanner::distanceField() (멀티 스레드, parallel_distance_field.h)로 생성. 값 타입이므로 복사/이동하여 캐시에 보관 가능.
+class DistanceField {
+public:
+    static constexpr int kUnreachable = INT_MAX;
+
+    DistanceField() = default;
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    Point goal() const { return goal_; }
+    bool empty() const { return dist_.empty(); }
+
+    // (x, y) -> 목표 최단 거리 (플래너의 비용 단위). 장애물, 지도 밖, 도달 불가능한 셀은 kUnreachable
+    int distance(int x, int y) const {
+        if (x < 0 || x >= rows_ || y < 0 || y >= cols_) return kUnreachable;
+        return dist_[index(x, y)];
+    }
+
+    // from에서 목표 쪽으로 한 칸 이동할 셀. from이 목표이거나 도달 불가능하면 false
+    bool nextStep(Point from, Point& next) const {
+        if (distance(from.x, from.y) == kUnreachable) return false;
+        int idx = next_[index(from.x, from.y)];
+        if (idx == -1) return false;
+        next = {idx / stride_ - 1, idx % stride_ - 1};
+        return true;
+    }
+
+    // from -> 목표 경로 전체. nextStep을 반복하므로 탐색 없이 경로 길이에 비례하는 시간.
+    bool path(Point from, std::vector<Point>& path) const {
+        path.clear();
+        if (distance(from.x, from.y) == kUnreachable) return false;
+        path.push_back(from);
+        Point next;
+        while (nextStep(path.back(), next)) path.push_back(next);
+        return true;
+    }
+
+private:
+    template <class, class, class> friend class BasicGridPlanner;
+    friend class WavefrontPlanner;
+    template <class, class> friend class BasicParallelDistancePlanner;
+
+    // GridMap과 같은 테두리 포함 인덱스를 사용.
+    int index(int x, int y) const { return (x + 1) * stride_ + (y + 1); }
+
+    void reset(const GridMap& map, Point goal) {
+        rows_ = map.rows();
+        cols_ = map.cols();
+        stride_ = map.stride();
+        goal_ = goal;
+        dist_.assign(map.cellCount(), kUnreachable);
+        next_.assign(map.cellCount(), -1);
+    }
+
+    int rows_ = 0, cols_ = 0, stride_ = 0;
+    Point goal_ = {0, 0};
+    std::vector<int> dist_;   // 셀 -> 목표 최단 거리
+    std::vector<int> next_;   // 목표 쪽으로의 다음 이동 셀 인덱스. 목표와 도달 불가능한 셀은 -1
+};
+
+#endif
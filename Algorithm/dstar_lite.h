@@ -0,0 +1,266 @@
+#ifndef DSTAR_LITE_H
+#define DSTAR_LITE_H
+
+#include <vector>
+#include <algorithm>
+#include <climits>
+
+#include "grid_map.h"
+#include "heuristic.h"
+
+// D* Lite (증분 재탐색)
+// 목표에서 시점 방향으로 탐색하며, 셀마다 g(현재 추정 비용)와 rhs(이웃 값으로 계산한 한 단계 앞의 비용)를 유지함.
+// 지도의 일부 셀이 바뀌면 그 주변 셀의 rhs만 다시 계산하고, g != rhs 인 (불일치) 셀만 다시 확장하므로
+// 바뀐 셀이 적을 때는 처음부터 다시 탐색하는 것보다 훨씬 적은 셀을 확장함.
+// 로봇이 이동하면 시점만 바꾸고 km(휴리스틱 보정값)을 늘려서 기존 openset의 키를 그대로 사용함.
+//
+// 4방향, 이동 비용 1, 맨해튼 거리 휴리스틱.
+// 지도는 참조만 보관하므로, 호출하는 쪽에서 GridMap::setBlocked()로 셀을 바꾼 뒤 replan()에 바뀐 셀 목록을 넘김.
+class DStarLitePlanner {
+public:
+    DStarLitePlanner() = default;
+
+    explicit DStarLitePlanner(const GridMap& map) {
+        bind(map);
+    }
+
+    void bind(const GridMap& map) {
+        map_ = &map;
+        stride_ = map.stride();
+        g_.assign(map.cellCount(), kInf);
+        rhs_.assign(map.cellCount(), kInf);
+        key1_.assign(map.cellCount(), 0);
+        key2_.assign(map.cellCount(), 0);
+        in_open_.assign(map.cellCount(), false);
+        for (int i = 0; i < 4; i++) {
+            offsets_[i] = kDirections[i][0] * stride_ + kDirections[i][1];
+        }
+    }
+
+    // 새 시점/목표에 대해 처음부터 탐색
+    // 시점이나 목표가 지도 밖이거나 장애물이면 빈 경로로 false 반환 (pathCost() == -1)
+    bool plan(Point start, Point goal, std::vector<Point>& path) {
+        std::fill(g_.begin(), g_.end(), kInf);
+        std::fill(rhs_.begin(), rhs_.end(), kInf);
+        std::fill(in_open_.begin(), in_open_.end(), false);
+        open_.clear();
+        km_ = 0;
+        visit_cnt_ = 0;
+        path.clear();
+        start_ = goal_ = last_ = -1;
+        if (!map_->isFree(start.x, start.y) || !map_->isFree(goal.x, goal.y)) return false;
+
+        start_ = map_->index(start.x, start.y);
+        goal_ = map_->index(goal.x, goal.y);
+        last_ = start_;
+        rhs_[goal_] = 0;
+        updateVertex(goal_);
+
+        computeShortestPath();
+        return extractPath(path);
+    }
+
+    // 지도에서 changed 셀들이 바뀐 뒤 이전 결과를 고쳐서 다시 탐색.
+    // start: 로봇의 현재 위치 (이전 경로를 따라 이동했다면 새 위치)
+    // 이전 plan()이 실패했거나 (목표 없음), 새 시점이 지도 밖이거나 시점/목표가 장애물이면 빈 경로로 false 반환.
+    // 지도 밖의 changed 셀은 무시함.
+    bool replan(Point start, const std::vector<Point>& changed, std::vector<Point>& path) {
+        path.clear();
+        visit_cnt_ = 0;
+        if (goal_ < 0) return false;
+
+        // 바뀐 셀과 그 이웃은 들어가고 나가는 간선 비용이 바뀌므로 rhs를 다시 계산
+        // (시점이 잘못되어 탐색하지 않더라도 바뀐 셀은 반영해 두어야 다음 replan이 맞음)
+        for (const Point& p : changed) {
+            if (!map_->inside(p.x, p.y)) continue;
+            int v = map_->index(p.x, p.y);
+            updateRhs(v);
+            for (int i = 0; i < 4; i++) {
+                int u = v + offsets_[i];
+                if (map_->isFree(u)) updateRhs(u);
+            }
+        }
+
+        if (!map_->isFree(start.x, start.y) || !map_->isFree(goal_)) {
+            start_ = -1;
+            return false;
+        }
+        // 시점이 움직인 만큼 휴리스틱이 줄어든 것을 km로 보정
+        start_ = map_->index(start.x, start.y);
+        km_ += heuristic(last_, start_);
+        last_ = start_;
+
+        computeShortestPath();
+        return extractPath(path);
+    }
+
+    // 마지막 plan/replan에서 확장한 셀 수
+    int visitCount() const { return visit_cnt_; }
+
+    // 현재 시점 -> 목표 최소 비용. 경로가 없으면 (시점/목표가 잘못된 경우 포함) -1
+    int pathCost() const { return start_ < 0 || goal_ < 0 || g_[start_] >= kInf ? -1 : g_[start_]; }
+
+private:
+    static constexpr int kInf = INT_MAX / 4;
+    static constexpr int kDirections[4][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}}; // 동, 남, 서, 북
+
+    // openset 항목 {key1, key2, idx}. 셀의 키가 바뀌면 새 항목을 넣고 이전 항목은 꺼낼 때 버림.
+    struct Entry {
+        int k1, k2, idx;
+    };
+
+    struct CompareEntry {
+        bool operator()(const Entry& a, const Entry& b) const {
+            return a.k1 != b.k1 ? a.k1 > b.k1 : a.k2 > b.k2;
+        }
+    };
+
+    static bool keyLess(int a1, int a2, int b1, int b2) {
+        return a1 < b1 || (a1 == b1 && a2 < b2);
+    }
+
+    int heuristic(int a, int b) const {
+        return ManhattanHeuristic()(map_->row(a), map_->col(a), map_->row(b), map_->col(b));
+    }
+
+    // u -> v 이동 후 v에서 목표까지 비용 (v가 장애물이거나 g(v)가 무한대면 무한대)
+    int costThrough(int v) const {
+        if (!map_->isFree(v) || g_[v] >= kInf) return kInf;
+        return g_[v] + 1;
+    }
+
+    void calculateKey(int u, int& k1, int& k2) const {
+        int m = std::min(g_[u], rhs_[u]);
+        k2 = m;
+        k1 = m >= kInf ? kInf : m + heuristic(start_, u) + km_;
+    }
+
+    void pushOpen(int u) {
+        calculateKey(u, key1_[u], key2_[u]);
+        in_open_[u] = true;
+        open_.push_back({key1_[u], key2_[u], u});
+        std::push_heap(open_.begin(), open_.end(), CompareEntry());
+    }
+
+    // 이전 키로 남아 있는 항목이나 openset에서 빠진 셀의 항목을 버림
+    void discardStale() {
+        while (!open_.empty()) {
+            const Entry& top = open_.front();
+            if (in_open_[top.idx] && top.k1 == key1_[top.idx] && top.k2 == key2_[top.idx]) return;
+            std::pop_heap(open_.begin(), open_.end(), CompareEntry());
+            open_.pop_back();
+        }
+    }
+
+    // g와 rhs가 다르면 openset에 (다시) 넣고, 같으면 openset에서 뺌
+    void updateVertex(int u) {
+        if (g_[u] != rhs_[u]) pushOpen(u);
+        else in_open_[u] = false;
+    }
+
+    // rhs(u) = min(이웃 v) (1 + g(v)). 목표는 항상 0, 장애물은 무한대
+    void updateRhs(int u) {
+        if (u == goal_) {
+            rhs_[u] = map_->isFree(u) ? 0 : kInf;
+        } else if (!map_->isFree(u)) {
+            rhs_[u] = kInf;
+        } else {
+            int best = kInf;
+            for (int i = 0; i < 4; i++) best = std::min(best, costThrough(u + offsets_[i]));
+            rhs_[u] = best;
+        }
+        updateVertex(u);
+    }
+
+    void computeShortestPath() {
+        visit_cnt_ = 0;
+        while (true) {
+            discardStale();
+            if (open_.empty()) break;
+
+            int s1, s2;
+            calculateKey(start_, s1, s2);
+            const Entry top = open_.front();
+            if (!keyLess(top.k1, top.k2, s1, s2) && rhs_[start_] == g_[start_]) break;
+
+            std::pop_heap(open_.begin(), open_.end(), CompareEntry());
+            open_.pop_back();
+            in_open_[top.idx] = false;
+
+            int u = top.idx;
+            int n1, n2;
+            calculateKey(u, n1, n2);
+            if (keyLess(top.k1, top.k2, n1, n2)) {
+                // km이 늘어서 키가 커진 셀: 새 키로 다시 넣음
+                pushOpen(u);
+                continue;
+            }
+
+            visit_cnt_++;
+            if (g_[u] > rhs_[u]) {
+                // 비용이 줄어든 셀: g 확정 후 이웃에 전파
+                g_[u] = rhs_[u];
+                for (int i = 0; i < 4; i++) {
+                    int s = u + offsets_[i];
+                    if (!map_->isFree(s) || s == goal_) continue;
+                    if (g_[u] + 1 < rhs_[s]) {
+                        rhs_[s] = g_[u] + 1;
+                        updateVertex(s);
+                    }
+                }
+            } else {
+                // 비용이 늘어난 셀: g를 무한대로 올리고 u를 거쳐 가던 이웃의 rhs를 다시 계산
+                int g_old = g_[u];
+                g_[u] = kInf;
+                updateRhs(u);
+                for (int i = 0; i < 4; i++) {
+                    int s = u + offsets_[i];
+                    if (!map_->isFree(s) || s == goal_) continue;
+                    if (rhs_[s] == g_old + 1) updateRhs(s);
+                }
+            }
+        }
+    }
+
+    // 시점에서 g가 가장 작은 이웃을 따라 목표까지 이동
+    bool extractPath(std::vector<Point>& path) const {
+        path.clear();
+        if (g_[start_] >= kInf) return false;
+
+        int current = start_;
+        path.push_back(map_->toPoint(current));
+        while (current != goal_) {
+            int best = -1, best_cost = kInf;
+            for (int i = 0; i < 4; i++) {
+                int c = costThrough(current + offsets_[i]);
+                if (c < best_cost) {
+                    best_cost = c;
+                    best = current + offsets_[i];
+                }
+            }
+            if (best == -1 || (int)path.size() > map_->cellCount()) {
+                path.clear();
+                return false;
+            }
+            current = best;
+            path.push_back(map_->toPoint(current));
+        }
+        return true;
+    }
+
+    const GridMap* map_ = nullptr;
+    int stride_ = 0;
+    int offsets_[4] = {};
+
+    std::vector<int> g_;            // 셀 -> 목표 비용 추정값
+    std::vector<int> rhs_;          // 이웃 g로 계산한 한 단계 앞의 값
+    std::vector<int> key1_, key2_;  // openset에 넣을 때의 키 (오래된 항목 판별용)
+    std::vector<bool> in_open_;
+    std::vector<Entry> open_;       // openset (min heap)
+
+    int start_ = -1, goal_ = -1, last_ = -1;
+    int km_ = 0;
+    int visit_cnt_ = 0;
+};
+
+#endif
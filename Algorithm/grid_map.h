@@ -0,0 +1,170 @@
+#ifndef GRID_MAP_H
+#define GRID_MAP_H
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <climits>
+
+// 격자 좌표 (x: 행, y: 열)
+struct Point {
+    int x, y;
+};
+
+inline bool operator==(const Point& a, const Point& b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+inline bool operator!=(const Point& a, const Point& b) {
+    return !(a == b);
+}
+
+// 점유 격자 지도
+// vector<vector<int>> 대신 1차원 연속 배열에 셀당 1 byte로 저장함. (행 우선, row-major)
+// 지도 둘레에 장애물 1칸을 덧대어(padding) 두었기 때문에, 지도 안의 셀에서 상하좌우로
+// (대각선 포함) 한 칸 이동한 셀은 항상 배열 범위 안에 있음. -> 이웃 탐색 시 범위 검사가 필요 없음.
+//
+// 셀 인덱스: idx = (x + 1) * stride + (y + 1),  stride = cols + 2
+// 이웃 셀: idx + 1 (동), idx + stride (남), idx - 1 (서), idx - stride (북), 대각선은 idx ± stride ± 1
+//
+// 셀 배열은 직접 소유(vector)하거나, 같은 배치로 된 외부 메모리(예: map_file.h의 mmap 파일)를 복사 없이 가리킬 수 있음.
+class GridMap {
+public:
+    static constexpr uint8_t kFree = 0;      // 이동 가능
+    static constexpr uint8_t kBlocked = 1;   // 장애물
+
+    GridMap() = default;
+
+    // rows x cols 크기의 빈 지도 (모든 셀 이동 가능)
+    // 비용 배열은 만들지 않음 (셀당 1 byte). 처음 setCost()를 호출할 때 할당됨.
+    GridMap(int rows, int cols)
+        : rows_(rows), cols_(cols), stride_(cols + 2), count_((rows + 2) * (cols + 2)),
+          cell_store_(count_, kFree) {
+        cells_ = cell_store_.data();
+        costs_ = nullptr;
+        // 테두리는 장애물
+        for (int y = 0; y < stride_; y++) {
+            cells_[y] = kBlocked;
+            cells_[(rows_ + 1) * stride_ + y] = kBlocked;
+        }
+        for (int x = 0; x < rows_ + 2; x++) {
+            cells_[x * stride_] = kBlocked;
+            cells_[x * stride_ + stride_ - 1] = kBlocked;
+        }
+    }
+
+    // 외부 메모리를 복사 없이 사용하는 지도.
+    // cells, costs: 테두리 포함 (rows + 2) x (cols + 2) 배열 (이 클래스와 같은 배치, 테두리는 장애물이어야 함)
+    //               costs가 nullptr이면 모든 셀의 비용은 1
+    // owner: 메모리를 소유한 객체. 이 지도(와 복사본)가 살아 있는 동안 같이 유지됨.
+    // 크기가 음수이거나 셀 수가 int 범위를 넘으면 빈 지도 (0 x 0)를 반환
+    static GridMap view(int rows, int cols, uint8_t* cells, uint8_t* costs, std::shared_ptr<void> owner) {
+        GridMap map;
+        if (rows < 0 || cols < 0 || ((int64_t)rows + 2) * ((int64_t)cols + 2) > INT_MAX) return map;
+        map.rows_ = rows;
+        map.cols_ = cols;
+        map.stride_ = cols + 2;
+        map.count_ = (rows + 2) * (cols + 2);
+        map.cells_ = cells;
+        map.costs_ = costs;
+        map.owner_ = std::move(owner);
+        return map;
+    }
+
+    // 소유한 배열은 복사하고, 외부 메모리는 같은 메모리를 가리킴.
+    GridMap(const GridMap& other)
+        : rows_(other.rows_), cols_(other.cols_), stride_(other.stride_), count_(other.count_),
+          cell_store_(other.cell_store_), cost_store_(other.cost_store_), owner_(other.owner_) {
+        attach(other);
+    }
+
+    GridMap& operator=(const GridMap& other) {
+        if (this != &other) {
+            rows_ = other.rows_;
+            cols_ = other.cols_;
+            stride_ = other.stride_;
+            count_ = other.count_;
+            cell_store_ = other.cell_store_;
+            cost_store_ = other.cost_store_;
+            owner_ = other.owner_;
+            attach(other);
+        }
+        return *this;
+    }
+
+    // vector 이동은 버퍼를 그대로 넘기므로 포인터도 그대로 유효함.
+    GridMap(GridMap&&) = default;
+    GridMap& operator=(GridMap&&) = default;
+
+    // 기존 maze 형식 (0은 이동 가능, 그 외는 장애물)으로부터 생성
+    static GridMap fromMaze(const std::vector<std::vector<int>>& maze) {
+        int rows = maze.size(), cols = maze.empty() ? 0 : maze[0].size();
+        GridMap map(rows, cols);
+        for (int x = 0; x < rows; x++) {
+            for (int y = 0; y < cols; y++) {
+                map.cells_[map.index(x, y)] = maze[x][y] == 0 ? kFree : kBlocked;
+            }
+        }
+        return map;
+    }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int stride() const { return stride_; }
+
+    // 테두리를 포함한 전체 셀 수. 셀 단위 배열의 크기로 사용.
+    int cellCount() const { return count_; }
+
+    int index(int x, int y) const { return (x + 1) * stride_ + (y + 1); }
+    int row(int idx) const { return idx / stride_ - 1; }
+    int col(int idx) const { return idx % stride_ - 1; }
+    Point toPoint(int idx) const { return {row(idx), col(idx)}; }
+
+    bool inside(int x, int y) const {
+        return x >= 0 && x < rows_ && y >= 0 && y < cols_;
+    }
+
+    // 인덱스로 검사. 테두리는 항상 장애물이므로 범위 검사 없음.
+    bool isFree(int idx) const { return cells_[idx] == kFree; }
+
+    // 좌표로 검사. 지도 밖의 좌표는 장애물로 취급.
+    bool isFree(int x, int y) const {
+        return inside(x, y) && cells_[index(x, y)] == kFree;
+    }
+
+    void setBlocked(int x, int y, bool blocked) {
+        cells_[index(x, y)] = blocked ? kBlocked : kFree;
+    }
+
+    // 셀에 들어갈 때의 이동 비용 배수 (1 ~ 255, 기본값 1). WeightedCost 정책에서 사용.
+    // 비용 배열이 없는 지도 (비용 없이 저장된 지도 파일)는 모든 셀이 1
+    int cost(int idx) const { return costs_ ? costs_[idx] : 1; }
+    int cost(int x, int y) const { return cost(index(x, y)); }
+
+    void setCost(int x, int y, uint8_t cost) {
+        if (!costs_) {
+            cost_store_.assign(count_, 1);
+            costs_ = cost_store_.data();
+        }
+        costs_[index(x, y)] = cost < 1 ? 1 : cost;
+    }
+
+    // 테두리 포함 (rows + 2) x (cols + 2) 배열. costData()는 비용 배열이 없으면 nullptr
+    const uint8_t* data() const { return cells_; }
+    const uint8_t* costData() const { return costs_; }
+
+private:
+    void attach(const GridMap& other) {
+        cells_ = other.cell_store_.empty() ? other.cells_ : cell_store_.data();
+        costs_ = other.cost_store_.empty() ? other.costs_ : cost_store_.data();
+    }
+
+    int rows_ = 0, cols_ = 0, stride_ = 2, count_ = 0;
+    uint8_t* cells_ = nullptr;     // 테두리 포함 (rows + 2) x (cols + 2). cell_store_ 또는 외부 메모리
+    uint8_t* costs_ = nullptr;     // 셀별 이동 비용 배수. cells_와 같은 인덱스
+    std::vector<uint8_t> cell_store_;
+    std::vector<uint8_t> cost_store_;
+    std::shared_ptr<void> owner_;  // 외부 메모리의 소유자 (mmap 등)
+};
+
+#endif
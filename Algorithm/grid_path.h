@@ -0,0 +1,155 @@
+#ifndef GRID_PATH_H
+#define GRID_PATH_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "grid_map.h"
+
+// 경로 결과 값 타입
+// GridPath: 셀 인덱스 (GridMap::index, int 4 byte)를 연속 배열 하나에 저장한 경로. 셀마다 따로 할당하지 않음.
+//   플래너가 버퍼처럼 채우므로 같은 GridPath를 재사용하면 탐색마다 할당이 없고, 이동(move)은 포인터 교환만 함.
+//   좌표는 읽을 때 인덱스에서 계산함. (path[i], 범위 for)
+// CompactPath: 시점 + 방향 체인 (run-length) 인코딩. 직선 구간 32칸이 1 byte이므로 많은 경로를 보관하거나 전송할 때 사용.
+
+class GridPath {
+public:
+    GridPath() = default;
+
+    size_t size() const { return cells_.size(); }
+    bool empty() const { return cells_.empty(); }
+    void clear() { cells_.clear(); }
+
+    // i번째 셀 좌표
+    Point operator[](size_t i) const { return toPoint(cells_[i]); }
+    Point front() const { return toPoint(cells_.front()); }
+    Point back() const { return toPoint(cells_.back()); }
+
+    // i번째 셀의 GridMap 인덱스와 인덱스 배열 (경로를 만든 지도의 stride 기준)
+    int cell(size_t i) const { return cells_[i]; }
+    const std::vector<int>& cells() const { return cells_; }
+    int stride() const { return stride_; }
+
+    // 좌표 벡터로 변환 (이전 API와 함께 쓸 때)
+    void toPoints(std::vector<Point>& points) const {
+        points.resize(cells_.size());
+        for (size_t i = 0; i < cells_.size(); i++) points[i] = toPoint(cells_[i]);
+    }
+
+    size_t capacityBytes() const { return cells_.capacity() * sizeof(int); }
+
+    // 범위 for용 반복자 (좌표를 값으로 반환)
+    class const_iterator {
+    public:
+        const_iterator(const int* cell, int stride) : cell_(cell), stride_(stride) {}
+        Point operator*() const { return {*cell_ / stride_ - 1, *cell_ % stride_ - 1}; }
+        const_iterator& operator++() {
+            ++cell_;
+            return *this;
+        }
+        bool operator!=(const const_iterator& other) const { return cell_ != other.cell_; }
+
+    private:
+        const int* cell_;
+        int stride_;
+    };
+
+    const_iterator begin() const { return {cells_.data(), stride_}; }
+    const_iterator end() const { return {cells_.data() + cells_.size(), stride_}; }
+
+private:
+    template <class, class, class> friend class BasicGridPlanner;
+    template <class, class> friend class BasicAnytimePlanner;
+    friend class CompactPath;
+
+    Point toPoint(int idx) const { return {idx / stride_ - 1, idx % stride_ - 1}; }
+
+    // 플래너가 경로를 채울 때 사용. 길이를 먼저 정하고 인덱스를 직접 씀
+    void resize(size_t length, int stride) {
+        cells_.resize(length);
+        stride_ = stride;
+    }
+
+    std::vector<int> cells_;
+    int stride_ = 0;
+};
+
+// 방향 체인 인코딩 경로
+// 1 byte = 방향 (상위 3 bit, 8방향) + 같은 방향으로 연속한 칸 수 - 1 (하위 5 bit, 1 ~ 32칸).
+// 4방향 / 8방향 경로 모두 사용 가능. 이웃하지 않은 셀이 이어진 경로 (중간 셀을 생략한 경로)는 인코딩할 수 없음.
+class CompactPath {
+public:
+    static constexpr int kMaxRun = 32;
+
+    CompactPath() = default;
+
+    // path를 인코딩. 연속한 두 셀이 (대각선 포함) 이웃하지 않으면 false
+    bool encode(const GridPath& path) {
+        chain_.clear();
+        length_ = path.size();
+        stride_ = path.stride();
+        if (path.empty()) return true;
+        start_ = path.front();
+
+        int prev_dir = -1, run = 0;
+        for (size_t i = 1; i < path.size(); i++) {
+            int dir = direction(path.cells_[i] - path.cells_[i - 1]);
+            if (dir < 0) {
+                chain_.clear();
+                length_ = 0;
+                return false;
+            }
+            if (dir == prev_dir && run < kMaxRun) {
+                run++;
+                continue;
+            }
+            if (run > 0) chain_.push_back(prev_dir << 5 | (run - 1));
+            prev_dir = dir;
+            run = 1;
+        }
+        if (run > 0) chain_.push_back(prev_dir << 5 | (run - 1));
+        return true;
+    }
+
+    // 셀 인덱스 경로로 복원 (path의 capacity 재사용)
+    void decode(GridPath& path) const {
+        path.resize(length_, stride_);
+        if (length_ == 0) return;
+        int idx = (start_.x + 1) * stride_ + (start_.y + 1), i = 0;
+        path.cells_[i++] = idx;
+        for (uint8_t code : chain_) {
+            const int offset = kDirections[code >> 5][0] * stride_ + kDirections[code >> 5][1];
+            for (int k = (code & 31) + 1; k > 0; k--) path.cells_[i++] = idx += offset;
+        }
+    }
+
+    size_t size() const { return length_; }   // 셀 수
+    bool empty() const { return length_ == 0; }
+    Point start() const { return start_; }
+
+    // 방향 체인 (1 byte = 직선 구간 1개)
+    const std::vector<uint8_t>& chain() const { return chain_; }
+
+    // 저장 크기 (byte): 시점, 셀 수, stride + 방향 체인
+    size_t bytes() const { return 4 * sizeof(int) + chain_.size(); }
+
+private:
+    // 방향 번호 -> (dx, dy)
+    static constexpr int kDirections[8][2] = {{0, 1}, {1, 1}, {1, 0}, {1, -1}, {0, -1}, {-1, -1}, {-1, 0}, {-1, 1}};
+
+    // 인덱스 차이 -> 방향 번호. 이웃이 아니면 -1
+    int direction(int delta) const {
+        for (int i = 0; i < 8; i++) {
+            if (delta == kDirections[i][0] * stride_ + kDirections[i][1]) return i;
+        }
+        return -1;
+    }
+
+    Point start_ = {0, 0};
+    size_t length_ = 0;
+    int stride_ = 0;
+    std::vector<uint8_t> chain_;
+};
+
+#endif
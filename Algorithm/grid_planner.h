@@ -0,0 +1,543 @@
+#ifndef GRID_PLANNER_H
+#define GRID_PLANNER_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+#include "grid_map.h"
+#include "grid_policy.h"
+#include "distance_field.h"
+#include "grid_path.h"
+#include "component_map.h"
+#include "heuristic.h"
+#include "open_list.h"
+#include "search_stats.h"
+
+// 같은 지도에 대해 반복해서 경로를 탐색하는 플래너
+// 지도는 bind()에서 한 번만 연결하고, g/parent/closed 배열과 openset 저장소는 탐색 간에 재사용함.
+// 각 배열의 값은 "세대(generation)" 번호로 유효성을 판단하므로 탐색 전 초기화는 O(1) (세대 번호 +1).
+// Neighborhood: 이동 방향 (FourConnected, EightConnected). grid_policy.h 참고
+// CostModel: 이동 비용 (UniformCost, WeightedCost). grid_policy.h 참고
+// OpenList: openset 구현 (HeapOpenList, BucketOpenList). open_list.h 참고
+template <class Neighborhood = FourConnected, class CostModel = UniformCost, class OpenList = HeapOpenList>
+class BasicGridPlanner {
+public:
+    BasicGridPlanner() = default;
+
+    explicit BasicGridPlanner(const GridMap& map) {
+        bind(map);
+    }
+
+    // 지도 연결. 크기가 바뀔 때만 버퍼를 다시 할당함.
+    // map은 플래너보다 오래 살아 있어야 함. (복사하지 않고 참조만 보관)
+    void bind(const GridMap& map) {
+        map_ = &map;
+        int cells = map.cellCount();
+        if (cells != (int)g_.size()) {
+            g_.assign(cells, INT_MAX);
+            parent_.assign(cells, -1);
+            seen_.assign(cells, 0);
+            closed_.assign(cells, 0);
+            generation_ = 0;
+        }
+        // 이웃 셀의 인덱스 차이. 지도의 stride에 따라 달라짐.
+        stride_ = map.stride();
+        for (int i = 0; i < Neighborhood::kCount; i++) {
+            offsets_[i] = Neighborhood::kDirections[i][0] * stride_ + Neighborhood::kDirections[i][1];
+        }
+    }
+
+    const GridMap& map() const { return *map_; }
+
+    // 연결 요소 레이블 (component_map.h) 연결. 설정하면 시점과 종점이 다른 영역일 때 탐색하지 않고 바로 false 반환.
+    // components는 같은 지도로 build하고, 셀을 바꿀 때마다 updateCells()로 맞춰 두어야 함. nullptr이면 사용 안 함
+    void setComponents(const ComponentMap* components) { components_ = components; }
+
+    // A* 알고리즘
+    // 경로를 찾으면 path에 시점->종점 순서로 저장하고 true 반환.
+    // path: std::vector<Point> (좌표) 또는 GridPath (셀 인덱스, grid_path.h). 아래의 다른 탐색 함수도 같음.
+    // Heuristic은 Neighborhood의 비용 단위에 맞아야 함. (4방향: 맨해튼/유클리디안, 8방향: 옥타일/스케일 유클리디안)
+    template <class Heuristic = typename Neighborhood::DefaultHeuristic, class Path>
+    bool aStarAlgorithm(Point start, Point goal, Path& path, Heuristic heuristic = Heuristic()) {
+        beginSearch(path);
+        if (!map_->isFree(start.x, start.y) || !map_->isFree(goal.x, goal.y)) return false;
+        if (!reachable(start, goal)) return false;
+
+        const int start_idx = map_->index(start.x, start.y);
+        const int goal_idx = map_->index(goal.x, goal.y);
+        setG(start_idx, 0, -1);
+        pushOpen(heuristic(start.x, start.y, goal.x, goal.y), start_idx);
+
+        while (!open_.empty()) {
+            int current = open_.pop();
+
+            // 이미 확장한 셀이면 건너뜀. (더 작은 g로 다시 push된 셀의 이전 항목)
+            if (isClosed(current)) {
+                countStalePop();
+                continue;
+            }
+            closed_[current] = generation_;
+            markExpanded(current);
+
+            // 목표 도달 시
+            if (current == goal_idx) {
+                path_cost_ = g_[current];
+                timer_.mark(stats_.search_us);
+                buildPath(current, path);
+                timer_.mark(stats_.path_us);
+                finishStats(path);
+                return true;
+            }
+
+            // 모든 이웃의 휴리스틱을 한 번에 계산 (batch4가 있는 휴리스틱은 SIMD)
+            int h[Neighborhood::kCount];
+            scoreNeighbors(heuristic, current, goal, h);
+
+            forEachMove<false>(current, [&](int next, int i, int move_cost) {
+                // 이동 비용을 더함. 이미 같거나 더 작은 비용으로 도달한 셀이면 push하지 않음.
+                int new_g = g_[current] + move_cost;
+                if (isClosed(next) || new_g >= g(next)) return;
+
+                setG(next, new_g, current);
+                pushOpen(new_g + h[i], next);
+            });
+        }
+        timer_.mark(stats_.search_us);
+        finishStats(path);
+        return false;
+    }
+
+    // 다익스트라 알고리즘 (단일 목표)
+    // end를 openset에서 꺼내는 순간 최단 거리가 확정되므로 그 즉시 탐색을 멈추고 역추적하여 path에 저장.
+    template <class Path>
+    bool dijkstra(Point start, Point end, Path& path) {
+        beginSearch(path);
+        if (!map_->isFree(start.x, start.y) || !map_->isFree(end.x, end.y)) return false;
+        if (!reachable(start, end)) return false;
+
+        const int start_idx = map_->index(start.x, start.y);
+        expandDijkstra<false>(start_idx, map_->index(end.x, end.y));
+
+        timer_.mark(stats_.search_us);
+
+        const int end_idx = map_->index(end.x, end.y);
+        if (g(end_idx) == INT_MAX) {
+            finishStats(path);
+            return false;
+        }
+        path_cost_ = g_[end_idx];
+
+        // 완화(relaxation) 때 기록한 parent를 따라 한 번에 역추적
+        buildPath(end_idx, path);
+        timer_.mark(stats_.path_us);
+        finishStats(path);
+        return true;
+    }
+
+    // 양방향 A*
+    // 시점에서 정방향, 종점에서 역방향으로 openset이 작은 쪽을 번갈아 확장하고,
+    // 한쪽이 다른 쪽에서 이미 도달한 셀로 완화할 때마다 시점->종점 경로 비용 mu를 갱신.
+    // 한쪽 openset의 최소 f가 mu 이상이면 그쪽으로 더 싼 경로가 남아 있을 수 없으므로 종료.
+    // -> 허용 가능한 휴리스틱이면 aStarAlgorithm()과 같은 비용. 확장한 셀은 양쪽 합계로 visitCount()에 기록.
+    // 역방향은 "셀 -> 종점" 방향의 이동 비용으로 완화하고, 휴리스틱도 "시점 -> 셀" 방향으로 계산하므로
+    // 셀 비용이 있어 두 방향의 거리가 달라도 정확함. (AltHeuristic처럼 비대칭인 휴리스틱 포함)
+    template <class Heuristic = typename Neighborhood::DefaultHeuristic, class Path>
+    bool bidirectionalAStar(Point start, Point goal, Path& path, Heuristic heuristic = Heuristic()) {
+        return searchBidirectional<false>(start, goal, path, heuristic);
+    }
+
+    // 양방향 다익스트라
+    // 휴리스틱이 없으므로 두 openset 최소 거리의 합이 mu 이상이면 종료. dijkstra()와 같은 비용.
+    template <class Path>
+    bool bidirectionalDijkstra(Point start, Point end, Path& path) {
+        return searchBidirectional<true>(start, end, path, ZeroHeuristic());
+    }
+
+    // 다익스트라 알고리즘 (전체 거리 지도)
+    // goal에서 도달 가능한 모든 셀까지 끝까지 탐색하여 field에 셀별 목표까지의 거리와 다음 이동 셀을 저장.
+    // goal에서 거꾸로 퍼져 나가면서 "셀 -> 목표" 방향의 이동 비용으로 완화하므로, 셀 비용이 있어도 정확한 cost-to-go.
+    // 이때 각 셀의 parent가 곧 목표 쪽으로의 다음 이동 셀.
+    bool distanceField(Point goal, DistanceField& field) {
+        beginSearch();
+        field.reset(*map_, goal);
+        if (!map_->isFree(goal.x, goal.y)) return false;
+
+        expandDijkstra<true>(map_->index(goal.x, goal.y), -1);
+        timer_.mark(stats_.search_us);
+
+        for (int idx = 0; idx < (int)field.dist_.size(); idx++) {
+            if (seen_[idx] != generation_) continue;
+            field.dist_[idx] = g_[idx];
+            field.next_[idx] = parent_[idx];
+        }
+        timer_.mark(stats_.path_us);
+        finishStats();
+        return true;
+    }
+
+    // 마지막 탐색에서 확장(방문)한 셀인지 확인 (양방향 탐색은 어느 한쪽에서라도 확장한 셀)
+    bool isVisited(int x, int y) const {
+        int idx = map_->index(x, y);
+        return isClosed(idx) || (!closed_b_.empty() && closed_b_[idx] == generation_);
+    }
+
+    // 마지막 탐색에서 확장(방문)한 셀의 수
+    int visitCount() const { return visit_cnt_; }
+
+    // 마지막 탐색에서 구한 시점->(x, y) 최소 비용. 도달하지 못했으면 INT_MAX
+    // 양방향 탐색은 정방향에서 도달한 셀만 값이 있으므로 경로 비용은 pathCost()를 사용.
+    int cost(int x, int y) const {
+        return g(map_->index(x, y));
+    }
+
+    // 마지막으로 찾은 시점->종점 경로의 비용 (aStarAlgorithm, dijkstra, 양방향 탐색)
+    int pathCost() const { return path_cost_; }
+
+    // 마지막 탐색의 통계 (search_stats.h). PLANNER_STATS=0으로 빌드하면 모두 0
+    const SearchStats& stats() const { return stats_; }
+
+    // 마지막 탐색의 확장 순서. PLANNER_TRACE=1로 빌드했을 때만 기록됨
+    const SearchTrace& trace() const { return trace_; }
+
+private:
+    bool isClosed(int idx) const { return closed_[idx] == generation_; }
+
+    // 연결 요소 레이블로 O(1) 확인. 레이블이 없으면 항상 true
+    bool reachable(Point start, Point goal) const {
+        return !components_ || components_->connected(map_->index(start.x, start.y), map_->index(goal.x, goal.y));
+    }
+
+    // 이번 세대에 값이 쓰이지 않은 셀은 INT_MAX로 취급
+    int g(int idx) const { return seen_[idx] == generation_ ? g_[idx] : INT_MAX; }
+
+    void setG(int idx, int g, int parent) {
+        seen_[idx] = generation_;
+        g_[idx] = g;
+        parent_[idx] = parent;
+    }
+
+    // current에서 이동 가능한 이웃마다 f(next, 방향 번호, 이동 비용)을 호출.
+    // 방향 루프는 컴파일 타임에 펼쳐지고, 대각선 검사와 셀 비용 계산은 정책에 따라 필요한 경우에만 들어감.
+    // 테두리가 장애물이므로 범위 검사 없이 장애물 여부만 확인.
+    // Reverse: true면 next -> current 방향으로 이동하는 비용 (목표에서 거꾸로 탐색할 때)
+    template <bool Reverse, class F>
+    void forEachMove(int current, F&& f) const {
+        forEachDirection<Neighborhood>([&](auto dir) {
+            constexpr int i = decltype(dir)::value;
+            const int next = current + offsets_[i];
+            if (!map_->isFree(next)) return;
+            if constexpr (isDiagonal<Neighborhood, i>()) {
+                // 대각선: 양옆 셀이 모두 비어 있어야 함 (모서리 통과 금지)
+                if (!map_->isFree(current + Neighborhood::kDirections[i][0] * stride_) ||
+                    !map_->isFree(current + Neighborhood::kDirections[i][1])) return;
+            }
+            f(next, i, CostModel::cost(*map_, Reverse ? current : next, stepCost<Neighborhood, i>()));
+        });
+    }
+
+    // 다익스트라 확장. stop_idx를 꺼내면 멈추고, -1이면 openset이 빌 때까지 진행.
+    // Reverse: distanceField()에서 목표로부터 거꾸로 탐색할 때 true
+    template <bool Reverse>
+    void expandDijkstra(int start_idx, int stop_idx) {
+        setG(start_idx, 0, -1);
+        pushOpen(0, start_idx);
+
+        while (!open_.empty()) {
+            int current = open_.pop();
+
+            // 방문했던 노드는 건너뜀
+            if (isClosed(current)) {
+                countStalePop();
+                continue;
+            }
+            closed_[current] = generation_;
+            markExpanded(current);
+
+            // 목표의 최단 거리 확정
+            if (current == stop_idx) return;
+
+            forEachMove<Reverse>(current, [&](int next, int, int move_cost) {
+                // 새로운 거리가 기존의 거리보다 짧은 경우 업데이트하고 우선순위 큐에 추가
+                int new_distance = g_[current] + move_cost;
+                if (new_distance < g(next)) {
+                    setG(next, new_distance, current);
+                    pushOpen(new_distance, next);
+                }
+            });
+        }
+    }
+
+    // 양방향 탐색. SumRule: 두 openset 최소값의 합으로 종료 판단 (휴리스틱이 0일 때)
+    template <bool SumRule, class Heuristic, class Path>
+    bool searchBidirectional(Point start, Point goal, Path& path, Heuristic heuristic) {
+        beginSearch(path);
+        if (!map_->isFree(start.x, start.y) || !map_->isFree(goal.x, goal.y)) return false;
+        if (!reachable(start, goal)) return false;
+
+        // 역방향 배열은 처음 사용할 때 할당
+        if (g_b_.size() != g_.size()) {
+            g_b_.assign(g_.size(), INT_MAX);
+            parent_b_.assign(g_.size(), -1);
+            seen_b_.assign(g_.size(), 0);
+            closed_b_.assign(g_.size(), 0);
+            if constexpr (kPlannerStats) stats_.bytes_allocated += g_.size() * (2 * sizeof(int) + 2 * sizeof(uint32_t));
+        }
+
+        const int start_idx = map_->index(start.x, start.y);
+        const int goal_idx = map_->index(goal.x, goal.y);
+        setG(start_idx, 0, -1);
+        setGBackward(goal_idx, 0, -1);
+        pushOpen(heuristic(start.x, start.y, goal.x, goal.y), start_idx);
+        pushOpenBackward(heuristic(start.x, start.y, goal.x, goal.y), goal_idx);
+
+        // mu: 지금까지 찾은 최선 경로 비용. 경로 = 시점 ~ meet_f (정방향) + meet_b ~ 종점 (역방향)
+        int mu = INT_MAX, meet_f = -1, meet_b = -1;
+        if (start_idx == goal_idx) {
+            mu = 0;
+            meet_f = meet_b = start_idx;
+        }
+
+        while (!open_.empty() && !open_b_.empty()) {
+            int top_f = open_.topPriority(), top_b = open_b_.topPriority();
+            if (SumRule ? top_f + top_b >= mu : std::max(top_f, top_b) >= mu) break;
+
+            if (open_.size() <= open_b_.size()) {
+                int current = open_.pop();
+                if (isClosed(current)) {
+                    countStalePop();
+                    continue;
+                }
+                closed_[current] = generation_;
+                markExpanded(current);
+
+                int h[Neighborhood::kCount];
+                scoreNeighbors(heuristic, current, goal, h);
+
+                forEachMove<false>(current, [&](int next, int i, int move_cost) {
+                    int new_g = g_[current] + move_cost;
+                    // 역방향에서 이미 도달한 셀이면 두 탐색이 만남
+                    if (seen_b_[next] == generation_ && new_g + g_b_[next] < mu) {
+                        mu = new_g + g_b_[next];
+                        meet_f = current;
+                        meet_b = next;
+                    }
+                    if (isClosed(next) || new_g >= g(next)) return;
+                    setG(next, new_g, current);
+                    pushOpen(new_g + h[i], next);
+                });
+            } else {
+                int current = open_b_.pop();
+                if (closed_b_[current] == generation_) {
+                    countStalePop();
+                    continue;
+                }
+                closed_b_[current] = generation_;
+                markExpanded(current);
+
+                int h[Neighborhood::kCount];
+                scoreNeighborsFrom(heuristic, start, current, h);
+
+                forEachMove<true>(current, [&](int next, int i, int move_cost) {
+                    int new_g = g_b_[current] + move_cost;
+                    if (seen_[next] == generation_ && new_g + g_[next] < mu) {
+                        mu = new_g + g_[next];
+                        meet_f = next;
+                        meet_b = current;
+                    }
+                    if (closed_b_[next] == generation_ || (seen_b_[next] == generation_ && new_g >= g_b_[next])) return;
+                    setGBackward(next, new_g, current);
+                    pushOpenBackward(new_g + h[i], next);
+                });
+            }
+        }
+        timer_.mark(stats_.search_us);
+        if (mu == INT_MAX) {
+            finishStats(path);
+            return false;
+        }
+
+        // 정방향 부분 (시점 ~ meet_f) 뒤에 역방향 부분 (meet_b ~ 종점)을 이어 붙임
+        // (시점 == 종점이면 두 부분이 같은 셀에서 시작하므로 역방향 부분은 그다음 셀부터)
+        path_cost_ = mu;
+        buildPath(meet_f, path);
+        const int first_b = meet_b == meet_f ? parent_b_[meet_b] : meet_b;
+        int i = path.size(), length = path.size();
+        for (int idx = first_b; idx != -1; idx = parent_b_[idx]) length++;
+        resizePath(path, length);
+        for (int idx = first_b; idx != -1; idx = parent_b_[idx]) storeCell(path, i++, idx);
+        timer_.mark(stats_.path_us);
+        finishStats(path);
+        return true;
+    }
+
+    // current의 모든 이웃 (방향 순서) -> goal 휴리스틱을 h에 계산
+    template <class Heuristic>
+    void scoreNeighbors(const Heuristic& heuristic, int current, Point goal, int* h) const {
+        int xs[Neighborhood::kCount], ys[Neighborhood::kCount];
+        const int cx = map_->row(current), cy = map_->col(current);
+        for (int i = 0; i < Neighborhood::kCount; i++) {
+            xs[i] = cx + Neighborhood::kDirections[i][0];
+            ys[i] = cy + Neighborhood::kDirections[i][1];
+        }
+        scoreBatch<Neighborhood::kCount>(heuristic, xs, ys, goal.x, goal.y, h);
+    }
+
+    // start -> current의 모든 이웃 (방향 순서) 휴리스틱을 h에 계산 (역방향 탐색의 하한)
+    template <class Heuristic>
+    void scoreNeighborsFrom(const Heuristic& heuristic, Point start, int current, int* h) const {
+        int xs[Neighborhood::kCount], ys[Neighborhood::kCount];
+        const int cx = map_->row(current), cy = map_->col(current);
+        for (int i = 0; i < Neighborhood::kCount; i++) {
+            xs[i] = cx + Neighborhood::kDirections[i][0];
+            ys[i] = cy + Neighborhood::kDirections[i][1];
+        }
+        scoreBatchFrom<Neighborhood::kCount>(heuristic, start.x, start.y, xs, ys, h);
+    }
+
+    void pushOpen(int priority, int idx) {
+        open_.push(priority, idx);
+        countPush();
+    }
+
+    void pushOpenBackward(int priority, int idx) {
+        open_b_.push(priority, idx);
+        countPush();
+    }
+
+    // 아래 계측 함수들은 PLANNER_STATS / PLANNER_TRACE가 꺼져 있으면 visit_cnt_ 증가 외에는 코드가 남지 않음.
+    void countPush() {
+        if constexpr (kPlannerStats) {
+            stats_.pushed++;
+            stats_.peak_open = std::max(stats_.peak_open, (int)(open_.size() + open_b_.size()));
+        }
+    }
+
+    void countStalePop() {
+        if constexpr (kPlannerStats) stats_.stale_pops++;
+    }
+
+    void markExpanded(int idx) {
+        visit_cnt_++;
+        if constexpr (kPlannerTrace) trace_.record(idx);
+    }
+
+    // openset 저장소 (+ 경로) capacity (byte)
+    size_t bufferBytes() const {
+        return open_.capacityBytes() + open_b_.capacityBytes();
+    }
+
+    size_t bufferBytes(const std::vector<Point>& path) const { return bufferBytes() + path.capacity() * sizeof(Point); }
+    size_t bufferBytes(const GridPath& path) const { return bufferBytes() + path.capacityBytes(); }
+
+    // 탐색 중 늘어난 저장소 크기를 통계에 기록 (distanceField()는 path 없이 호출)
+    template <class... Path>
+    void finishStats(const Path&... path) {
+        if constexpr (kPlannerStats) {
+            stats_.expanded = visit_cnt_;
+            size_t bytes = bufferBytes(path...);
+            if (bytes > base_bytes_) stats_.bytes_allocated += bytes - base_bytes_;
+        }
+    }
+
+    void setGBackward(int idx, int g, int parent) {
+        seen_b_[idx] = generation_;
+        g_b_[idx] = g;
+        parent_b_[idx] = parent;
+    }
+
+    // 새 탐색 시작: 세대 번호만 올려서 이전 탐색 결과를 무효화함.
+    // 세대 번호가 한 바퀴 돌았을 때만 전체 배열을 초기화.
+    void beginSearch() {
+        if constexpr (kPlannerStats) {
+            timer_.start();
+            stats_.clear();
+        }
+        if constexpr (kPlannerTrace) trace_.clear();
+        if (++generation_ == 0) {
+            std::fill(seen_.begin(), seen_.end(), 0);
+            std::fill(closed_.begin(), closed_.end(), 0);
+            std::fill(seen_b_.begin(), seen_b_.end(), 0);
+            std::fill(closed_b_.begin(), closed_b_.end(), 0);
+            generation_ = 1;
+        }
+        open_.clear();
+        open_b_.clear();
+        visit_cnt_ = 0;
+        if constexpr (kPlannerStats) {
+            base_bytes_ = bufferBytes();
+            timer_.mark(stats_.setup_us);
+        }
+    }
+
+    template <class Path>
+    void beginSearch(Path& path) {
+        beginSearch();
+        path.clear();
+        if constexpr (kPlannerStats) base_bytes_ = bufferBytes(path);
+    }
+
+    // parent를 따라 경로를 만듦. 먼저 경로 길이를 세어 path 크기를 정한 뒤 뒤에서부터 채움.
+    // path의 capacity가 충분하면 추가 할당이 없고, reverse도 필요 없음. O(경로 길이)
+    template <class Path>
+    void buildPath(int goal_idx, Path& path) const {
+        int length = 0;
+        for (int idx = goal_idx; idx != -1; idx = parent_[idx]) length++;
+
+        resizePath(path, length);
+        for (int idx = goal_idx; idx != -1; idx = parent_[idx]) {
+            storeCell(path, --length, idx);
+        }
+    }
+
+    // 경로 타입별 저장 (좌표 / 셀 인덱스)
+    void resizePath(std::vector<Point>& path, int length) const { path.resize(length); }
+    void resizePath(GridPath& path, int length) const { path.resize(length, stride_); }
+    void storeCell(std::vector<Point>& path, int i, int idx) const { path[i] = map_->toPoint(idx); }
+    void storeCell(GridPath& path, int i, int idx) const { path.cells_[i] = idx; }
+
+    const GridMap* map_ = nullptr;
+    int stride_ = 0;
+    int offsets_[Neighborhood::kCount] = {};   // Neighborhood::kDirections에 대응하는 인덱스 차이
+    const ComponentMap* components_ = nullptr;
+
+    std::vector<int> g_;                 // 시점->셀 최소 비용
+    std::vector<int> parent_;            // 부모 셀의 인덱스. 시점은 -1
+    std::vector<uint32_t> seen_;         // g_/parent_ 값이 기록된 세대
+    std::vector<uint32_t> closed_;       // 확장이 끝난 세대
+    uint32_t generation_ = 0;
+
+    OpenList open_;                      // openset {f, idx}
+    int visit_cnt_ = 0;
+    int path_cost_ = 0;
+
+    // 양방향 탐색의 역방향 (종점->셀) 배열. 처음 양방향 탐색할 때 할당하고 세대 번호는 정방향과 공유
+    std::vector<int> g_b_;
+    std::vector<int> parent_b_;
+    std::vector<uint32_t> seen_b_;
+    std::vector<uint32_t> closed_b_;
+    OpenList open_b_;
+
+    // 계측 (search_stats.h)
+    SearchStats stats_;
+    SearchTrace trace_;
+    PhaseTimer timer_;
+    size_t base_bytes_ = 0;     // 탐색 시작 시 openset/path 저장소 크기
+};
+
+// 4방향, 균일 비용, 이진 힙 openset을 사용하는 기본 플래너
+using GridPlanner = BasicGridPlanner<FourConnected, UniformCost, HeapOpenList>;
+
+// 버킷 큐 openset을 사용하는 플래너. 이동 비용이 정수인 격자에서 openset 연산이 O(1)
+using BucketGridPlanner = BasicGridPlanner<FourConnected, UniformCost, BucketOpenList>;
+
+// 8방향 (직선 10, 대각선 14) 플래너
+using GridPlanner8 = BasicGridPlanner<EightConnected, UniformCost, HeapOpenList>;
+
+// 셀 비용(GridMap::cost)을 반영하는 플래너
+using WeightedGridPlanner = BasicGridPlanner<FourConnected, WeightedCost, HeapOpenList>;
+using WeightedGridPlanner8 = BasicGridPlanner<EightConnected, WeightedCost, HeapOpenList>;
+
+#endif
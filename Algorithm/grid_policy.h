@@ -0,0 +1,67 @@
+#ifndef GRID_POLICY_H
+#define GRID_POLICY_H
+
+#include <utility>
+#include <type_traits>
+
+#include "grid_map.h"
+#include "heuristic.h"
+
+// 플래너의 컴파일 타임 정책
+// 이동 방향(Neighborhood)과 이동 비용(CostModel)을 템플릿 인자로 받아서,
+// 이웃 순회 루프를 방향별로 펼치고(unroll) 자주 쓰는 조합에서는 실행 중 분기가 없도록 함.
+
+// 4방향 이동 (동, 남, 서, 북). 이동 비용 1
+struct FourConnected {
+    static constexpr int kCount = 4;
+    static constexpr int kDirections[4][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}};
+    static constexpr int kStraightCost = 1;
+    static constexpr int kDiagonalCost = 0;   // 사용 안 함
+    using DefaultHeuristic = ManhattanHeuristic;
+};
+
+// 8방향 이동. 직선 10, 대각선 14 (√2 ≈ 1.4)
+// 대각선은 양옆의 직선 방향 셀이 모두 비어 있을 때만 이동 가능 (모서리 통과 금지). JpsPlanner8과 같은 규칙.
+struct EightConnected {
+    static constexpr int kCount = 8;
+    static constexpr int kDirections[8][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0},
+                                              {1, 1}, {1, -1}, {-1, -1}, {-1, 1}};
+    static constexpr int kStraightCost = 10;
+    static constexpr int kDiagonalCost = 14;
+    using DefaultHeuristic = OctileHeuristic;
+};
+
+// 모든 셀의 이동 비용이 같음
+struct UniformCost {
+    static int cost(const GridMap&, int, int step_cost) { return step_cost; }
+};
+
+// 들어가는 셀의 비용(GridMap::cost)을 곱함. 셀 비용이 1 이상이면 위의 휴리스틱들이 그대로 허용 가능(admissible).
+struct WeightedCost {
+    static int cost(const GridMap& map, int to, int step_cost) { return step_cost * map.cost(to); }
+};
+
+// 방향 i가 대각선인지
+template <class Neighborhood, int I>
+constexpr bool isDiagonal() {
+    return Neighborhood::kDirections[I][0] != 0 && Neighborhood::kDirections[I][1] != 0;
+}
+
+// 방향 i의 이동 비용 (셀 비용을 곱하기 전)
+template <class Neighborhood, int I>
+constexpr int stepCost() {
+    return isDiagonal<Neighborhood, I>() ? Neighborhood::kDiagonalCost : Neighborhood::kStraightCost;
+}
+
+template <class Neighborhood, class F, int... I>
+inline void forEachDirectionImpl(F&& f, std::integer_sequence<int, I...>) {
+    (f(std::integral_constant<int, I>()), ...);
+}
+
+// 모든 방향에 대해 f(integral_constant<int, i>)를 호출. 방향 번호가 컴파일 타임 상수이므로 루프가 펼쳐짐.
+template <class Neighborhood, class F>
+inline void forEachDirection(F&& f) {
+    forEachDirectionImpl<Neighborhood>(f, std::make_integer_sequence<int, Neighborhood::kCount>());
+}
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef HEURISTIC_H
+#define HEURISTIC_H
+
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// 휴리스틱 함수 객체
+// A* 계열 탐색에서 (x1, y1) -> (x2, y2) 까지의 예상 비용을 계산함.
+// 옥타일 / 스케일 유클리디안 거리를 제외하면 이동 1칸의 비용이 1인 격자를 기준으로 함.
+// 모든 휴리스틱은 정수 g와 같은 정수 단위로 값을 돌려줌. (부동소수점 pow 없음)
+//
+// 휴리스틱은 플래너의 템플릿 인자로 컴파일 타임에 선택함.
+// batch4(xs, ys, gx, gy, out): 좌표 4개를 한 번에 계산하는 SIMD 버전. (x86-64는 SSE2, 그 외는 스칼라 루프)
+// 플래너는 batch4가 있는 휴리스틱이면 셀을 확장할 때 모든 이웃의 휴리스틱을 한 번에 계산함. (scoreNeighbors 참고)
+// 좌표 차이는 |dx|, |dy| < 32768 이어야 함. (유클리디안 SIMD 버전이 16 bit 곱셈을 사용)
+// batch4는 좌표 차이의 절대값만 사용하는 대칭 휴리스틱에만 둠. (scoreBatchFrom이 인자 순서를 바꿔서 사용)
+
+// floor(sqrt(n)). 정수 n은 double로 정확히 표현되고, 정수가 아닌 제곱근과 가장 가까운 정수 사이의 거리가
+// double 오차보다 훨씬 크므로 결과는 정확한 정수 제곱근과 같음.
+inline int floorSqrt(int64_t n) {
+    return (int)std::sqrt((double)n);
+}
+
+#if defined(__SSE2__)
+namespace heuristic_simd {
+
+inline __m128i abs32(__m128i v) {
+    __m128i sign = _mm_srai_epi32(v, 31);
+    return _mm_sub_epi32(_mm_xor_si128(v, sign), sign);
+}
+
+inline __m128i max32(__m128i a, __m128i b) {
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+}
+
+inline __m128i min32(__m128i a, __m128i b) {
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+
+// |x - gx|, |y - gy| (4개)
+inline void delta(const int* xs, const int* ys, int gx, int gy, __m128i& dx, __m128i& dy) {
+    dx = abs32(_mm_sub_epi32(_mm_loadu_si128((const __m128i*)xs), _mm_set1_epi32(gx)));
+    dy = abs32(_mm_sub_epi32(_mm_loadu_si128((const __m128i*)ys), _mm_set1_epi32(gy)));
+}
+
+// floor(sqrt(scale * (dx^2 + dy^2))) (4개)
+// dx, dy를 16 bit 쌍으로 묶어서 _mm_madd_epi16 한 번으로 dx^2 + dy^2를 계산하고, double 2개씩 sqrt.
+inline void euclidean(__m128i dx, __m128i dy, double scale, int* out) {
+    __m128i pairs_lo = _mm_or_si128(dx, _mm_slli_epi32(dy, 16));
+    __m128i squares = _mm_madd_epi16(pairs_lo, pairs_lo);
+    __m128d s = _mm_set1_pd(scale);
+    __m128d lo = _mm_sqrt_pd(_mm_mul_pd(_mm_cvtepi32_pd(squares), s));
+    __m128d hi = _mm_sqrt_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(squares, 8)), s));
+    __m128i result = _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+    _mm_storeu_si128((__m128i*)out, result);
+}
+
+}  // namespace heuristic_simd
+#endif
+
+// 유클리디안 거리 (소수점 이하 버림)
+// 이전 구현 (sqrt(pow + pow)를 int로 자름)과 같은 값을 정수 제곱합 + sqrt 한 번으로 계산.
+struct EuclideanHeuristic {
+    int operator()(int x1, int y1, int x2, int y2) const {
+        int64_t dx = x1 - x2, dy = y1 - y2;
+        return floorSqrt(dx * dx + dy * dy);
+    }
+
+    void batch4(const int* xs, const int* ys, int gx, int gy, int* out) const {
+#if defined(__SSE2__)
+        __m128i dx, dy;
+        heuristic_simd::delta(xs, ys, gx, gy, dx, dy);
+        heuristic_simd::euclidean(dx, dy, 1.0, out);
+#else
+        for (int i = 0; i < 4; i++) out[i] = (*this)(xs[i], ys[i], gx, gy);
+#endif
+    }
+};
+
+// 맨해튼 거리
+struct ManhattanHeuristic {
+    int operator()(int x1, int y1, int x2, int y2) const {
+        return std::abs(x1 - x2) + std::abs(y1 - y2);
+    }
+
+    void batch4(const int* xs, const int* ys, int gx, int gy, int* out) const {
+#if defined(__SSE2__)
+        __m128i dx, dy;
+        heuristic_simd::delta(xs, ys, gx, gy, dx, dy);
+        _mm_storeu_si128((__m128i*)out, _mm_add_epi32(dx, dy));
+#else
+        for (int i = 0; i < 4; i++) out[i] = (*this)(xs[i], ys[i], gx, gy);
+#endif
+    }
+};
+
+// 옥타일 거리 (8방향 이동)
+// 직선 이동 비용 10, 대각선 이동 비용 14 (√2 ≈ 1.4) 기준의 정수 거리.
+struct OctileHeuristic {
+    int operator()(int x1, int y1, int x2, int y2) const {
+        int dx = std::abs(x1 - x2), dy = std::abs(y1 - y2);
+        return 10 * (dx > dy ? dx : dy) + 4 * (dx < dy ? dx : dy);
+    }
+
+    void batch4(const int* xs, const int* ys, int gx, int gy, int* out) const {
+#if defined(__SSE2__)
+        __m128i dx, dy;
+        heuristic_simd::delta(xs, ys, gx, gy, dx, dy);
+        __m128i hi = heuristic_simd::max32(dx, dy), lo = heuristic_simd::min32(dx, dy);
+        // 10 * hi + 4 * lo = (hi << 3) + (hi << 1) + (lo << 2)
+        __m128i h = _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(hi, 3), _mm_slli_epi32(hi, 1)), _mm_slli_epi32(lo, 2));
+        _mm_storeu_si128((__m128i*)out, h);
+#else
+        for (int i = 0; i < 4; i++) out[i] = (*this)(xs[i], ys[i], gx, gy);
+#endif
+    }
+};
+
+// 스케일 유클리디안 거리 (8방향 이동, 옥타일과 같은 10 / 14 단위)
+// floor(7√2 * 유클리디안 거리) = floor(sqrt(98 * (dx^2 + dy^2))).
+// 7√2 ≈ 9.9 이므로 직선 1칸은 10 이하, 대각선 1칸은 정확히 14가 되어 허용 가능(admissible)하고 일관적(consistent)임.
+// 옥타일보다 작은 값이므로 확장 수는 늘어나지만, 8방향 이동 외의 (임의 각도) 비용 모델에도 그대로 사용 가능.
+struct ScaledEuclideanHeuristic {
+    int operator()(int x1, int y1, int x2, int y2) const {
+        int64_t dx = x1 - x2, dy = y1 - y2;
+        return floorSqrt(98 * (dx * dx + dy * dy));
+    }
+
+    void batch4(const int* xs, const int* ys, int gx, int gy, int* out) const {
+#if defined(__SSE2__)
+        __m128i dx, dy;
+        heuristic_simd::delta(xs, ys, gx, gy, dx, dy);
+        heuristic_simd::euclidean(dx, dy, 98.0, out);
+#else
+        for (int i = 0; i < 4; i++) out[i] = (*this)(xs[i], ys[i], gx, gy);
+#endif
+    }
+};
+
+// 휴리스틱 0: A*가 다익스트라와 같아짐
+struct ZeroHeuristic {
+    int operator()(int, int, int, int) const {
+        return 0;
+    }
+
+    void batch4(const int*, const int*, int, int, int* out) const {
+        out[0] = out[1] = out[2] = out[3] = 0;
+    }
+};
+
+// Heuristic에 batch4가 있는지 (사용자 정의 휴리스틱은 없어도 됨)
+template <class Heuristic, class = void>
+struct HasBatch4 : std::false_type {};
+
+template <class Heuristic>
+struct HasBatch4<Heuristic, std::void_t<decltype(std::declval<const Heuristic&>().batch4(
+                                (const int*)nullptr, (const int*)nullptr, 0, 0, (int*)nullptr))>> : std::true_type {};
+
+// xs[i], ys[i] -> (gx, gy) 휴리스틱을 out[i]에 계산 (i < N).
+// batch4가 있으면 4개씩 SIMD로, 없으면 하나씩 계산. N은 4의 배수일 때 batch4를 사용.
+template <int N, class Heuristic>
+inline void scoreBatch(const Heuristic& heuristic, const int* xs, const int* ys, int gx, int gy, int* out) {
+    if constexpr (HasBatch4<Heuristic>::value && N % 4 == 0) {
+        for (int i = 0; i < N; i += 4) heuristic.batch4(xs + i, ys + i, gx, gy, out + i);
+    } else {
+        for (int i = 0; i < N; i++) out[i] = heuristic(xs[i], ys[i], gx, gy);
+    }
+}
+
+// (sx, sy) -> xs[i], ys[i] 휴리스틱을 out[i]에 계산 (i < N). 역방향 탐색용.
+// 셀 비용이 있는 지도에서는 두 방향의 거리가 다르므로, 비대칭 휴리스틱 (AltHeuristic 등)은 인자 순서대로 계산해야 함.
+// batch4가 있는 휴리스틱은 대칭이므로 scoreBatch와 같이 SIMD로 계산.
+template <int N, class Heuristic>
+inline void scoreBatchFrom(const Heuristic& heuristic, int sx, int sy, const int* xs, const int* ys, int* out) {
+    if constexpr (HasBatch4<Heuristic>::value && N % 4 == 0) {
+        for (int i = 0; i < N; i += 4) heuristic.batch4(xs + i, ys + i, sx, sy, out + i);
+    } else {
+        for (int i = 0; i < N; i++) out[i] = heuristic(sx, sy, xs[i], ys[i]);
+    }
+}
+
+#endif
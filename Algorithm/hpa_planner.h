@@ -0,0 +1,443 @@
+#ifndef HPA_PLANNER_H
+#define HPA_PLANNER_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+
+#include "grid_map.h"
+#include "heuristic.h"
+#include "open_list.h"
+
+// HPA* (Hierarchical Path-finding A*)
+// 지도를 cluster_size x cluster_size 크기의 클러스터로 나누고, 이웃 클러스터 경계에서 양쪽이 모두 비어 있는 구간마다
+// 출입구(entrance) 셀 쌍을 만들어서 추상 그래프의 노드로 사용함.
+//   - 경계 간선 (inter edge): 출입구 셀 쌍 사이, 비용 1
+//   - 내부 간선 (intra edge): 같은 클러스터 안의 노드 쌍 사이, 클러스터 안에서만 이동한 최단 거리 (미리 계산)
+// 탐색 시에는 시점/종점을 자기 클러스터의 노드에 연결한 뒤 추상 그래프에서 A*를 돌리고,
+// 결과 경로의 각 구간만 해당 클러스터 안에서 BFS로 펼쳐서(refine) 격자 경로를 만듦.
+// -> 확장하는 셀 수가 지도 크기가 아니라 (추상 노드 수 + 경로 주변 클러스터 크기)에 비례함.
+//
+// 4방향, 이동 비용 1. 클러스터 경계를 지나는 위치가 출입구로 제한되므로 경로는 최단 경로보다 조금 길 수 있음.
+// 지도는 참조만 보관하므로, 셀을 바꾼 뒤 updateCells()에 바뀐 셀 목록을 넘기면 해당 클러스터와 이웃만 다시 계산함.
+class HpaPlanner {
+public:
+    static constexpr int kDefaultClusterSize = 16;
+
+    HpaPlanner() = default;
+
+    explicit HpaPlanner(const GridMap& map, int cluster_size = kDefaultClusterSize) {
+        bind(map, cluster_size);
+    }
+
+    // 지도 연결 후 추상 그래프 전체를 계산
+    void bind(const GridMap& map, int cluster_size = kDefaultClusterSize) {
+        map_ = &map;
+        size_ = std::max(1, cluster_size);
+        crows_ = (map.rows() + size_ - 1) / size_;
+        ccols_ = (map.cols() + size_ - 1) / size_;
+
+        int count = crows_ * ccols_;
+        clusters_.assign(count, Cluster());
+        hborder_.assign(count, {});
+        vborder_.assign(count, {});
+
+        ldist_.assign(size_ * size_, 0);
+        lparent_.assign(size_ * size_, -1);
+        lseen_.assign(size_ * size_, 0);
+        lgeneration_ = 0;
+        cap_ = 0;
+
+        for (int c = 0; c < count; c++) buildBorders(c);
+        for (int c = 0; c < count; c++) buildCluster(c);
+        resizeSearch();
+    }
+
+    // changed 셀들이 바뀐 뒤 호출. 바뀐 셀이 속한 클러스터의 경계 출입구와,
+    // 그 클러스터 및 이웃 클러스터의 내부 간선만 다시 계산함.
+    void updateCells(const std::vector<Point>& changed) {
+        std::vector<int> dirty, rebuild;
+        for (const Point& p : changed) {
+            if (map_->inside(p.x, p.y)) dirty.push_back(clusterOf(p.x, p.y));
+        }
+        std::sort(dirty.begin(), dirty.end());
+        dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+        for (int c : dirty) {
+            int cr = c / ccols_, cc = c % ccols_;
+            buildBorders(c);
+            rebuild.push_back(c);
+            if (cr > 0) {
+                buildBorders(c - ccols_);
+                rebuild.push_back(c - ccols_);
+            }
+            if (cc > 0) {
+                buildBorders(c - 1);
+                rebuild.push_back(c - 1);
+            }
+            if (cr + 1 < crows_) rebuild.push_back(c + ccols_);
+            if (cc + 1 < ccols_) rebuild.push_back(c + 1);
+        }
+        std::sort(rebuild.begin(), rebuild.end());
+        rebuild.erase(std::unique(rebuild.begin(), rebuild.end()), rebuild.end());
+
+        for (int c : rebuild) buildCluster(c);
+        resizeSearch();
+    }
+
+    // 경로 탐색. 경로를 찾으면 path에 시점->종점 순서로 좌표를 저장하고 true 반환.
+    bool findPath(Point start, Point goal, std::vector<Point>& path) {
+        path.clear();
+        visit_cnt_ = 0;
+        abstract_visit_cnt_ = 0;
+        if (!map_->isFree(start.x, start.y) || !map_->isFree(goal.x, goal.y)) return false;
+
+        start_idx_ = map_->index(start.x, start.y);
+        goal_idx_ = map_->index(goal.x, goal.y);
+        if (start_idx_ == goal_idx_) {
+            path.push_back(start);
+            return true;
+        }
+
+        const int cs = clusterOf(start.x, start.y);
+        const int cg = clusterOf(goal.x, goal.y);
+        const int start_id = (int)clusters_.size() * cap_;
+        const int goal_id = start_id + 1;
+
+        // 시점을 자기 클러스터의 노드에 연결 (같은 클러스터면 종점에도 직접 연결)
+        start_edges_.clear();
+        visit_cnt_ += bfs(cs, start_idx_, -1);
+        const Cluster& scl = clusters_[cs];
+        for (int i = 0; i < (int)scl.nodes.size(); i++) {
+            int d = localDist(cs, scl.nodes[i]);
+            if (d != kInf) start_edges_.push_back({cs * cap_ + i, d});
+        }
+        if (cs == cg) {
+            int d = localDist(cs, goal_idx_);
+            if (d != kInf) start_edges_.push_back({goal_id, d});
+        }
+
+        // 종점 클러스터의 노드 -> 종점 거리
+        visit_cnt_ += bfs(cg, goal_idx_, -1);
+        const Cluster& gcl = clusters_[cg];
+        goal_dist_.resize(gcl.nodes.size());
+        for (int i = 0; i < (int)gcl.nodes.size(); i++) goal_dist_[i] = localDist(cg, gcl.nodes[i]);
+
+        // 추상 그래프에서 A*
+        beginSearch();
+        setG(start_id, 0, -1);
+        open_.push(heuristic(start_idx_), start_id);
+
+        bool found = false;
+        while (!open_.empty()) {
+            int current = open_.pop();
+            if (closed_[current] == generation_) continue;
+            closed_[current] = generation_;
+            abstract_visit_cnt_++;
+
+            if (current == goal_id) {
+                found = true;
+                break;
+            }
+
+            auto relax = [&](int next, int cost) {
+                int new_g = g_[current] + cost;
+                if (seen_[next] != generation_ || new_g < g_[next]) {
+                    setG(next, new_g, current);
+                    open_.push(new_g + heuristic(cellOf(next)), next);
+                }
+            };
+
+            if (current == start_id) {
+                for (const auto& e : start_edges_) relax(e.first, e.second);
+                continue;
+            }
+
+            const int c = current / cap_, s = current % cap_;
+            const Cluster& cl = clusters_[c];
+            const int k = cl.nodes.size();
+
+            // 내부 간선
+            for (int j = 0; j < k; j++) {
+                int d = cl.dist[s * k + j];
+                if (j != s && d != kInf) relax(c * cap_ + j, d);
+            }
+            // 경계 간선
+            for (int partner : cl.links[s]) {
+                int pc = clusterOf(map_->row(partner), map_->col(partner));
+                relax(pc * cap_ + slotOf(pc, partner), 1);
+            }
+            // 종점 클러스터의 노드이면 종점으로
+            if (c == cg && goal_dist_[s] != kInf) relax(goal_id, goal_dist_[s]);
+        }
+        visit_cnt_ += abstract_visit_cnt_;
+        if (!found) return false;
+
+        // 추상 경로 (셀 인덱스)를 시점부터 순서대로
+        abstract_path_.clear();
+        for (int id = goal_id; id != -1; id = parent_[id]) abstract_path_.push_back(cellOf(id));
+        std::reverse(abstract_path_.begin(), abstract_path_.end());
+
+        // 구간별로 클러스터 안에서 펼침
+        path.push_back(start);
+        for (int i = 1; i < (int)abstract_path_.size(); i++) {
+            refineSegment(abstract_path_[i - 1], abstract_path_[i], path);
+        }
+        return true;
+    }
+
+    // 마지막 탐색에서 확장한 셀 + 추상 노드 수 (시점/종점 연결, 추상 A*, 구간 펼치기 포함)
+    int visitCount() const { return visit_cnt_; }
+
+    // 마지막 탐색에서 추상 그래프 A*가 확장한 노드 수
+    int abstractVisitCount() const { return abstract_visit_cnt_; }
+
+    // 추상 그래프의 노드 수 (출입구 셀 수)
+    int nodeCount() const {
+        int n = 0;
+        for (const Cluster& cl : clusters_) n += cl.nodes.size();
+        return n;
+    }
+
+    int clusterSize() const { return size_; }
+
+private:
+    static constexpr int kInf = INT_MAX / 4;
+    // 경계에서 연속으로 열린 구간이 이 길이 이상이면 양 끝에 출입구 2개, 미만이면 가운데에 1개
+    static constexpr int kMaxSingleEntrance = 6;
+
+    struct Cluster {
+        std::vector<int> nodes;                 // 출입구 셀 인덱스
+        std::vector<std::vector<int>> links;    // nodes[i]와 경계 간선으로 연결된 이웃 클러스터의 셀 인덱스
+        std::vector<int> dist;                  // k x k 내부 거리 (클러스터 안에서 이동 불가능하면 kInf)
+    };
+
+    int clusterOf(int x, int y) const { return (x / size_) * ccols_ + (y / size_); }
+
+    // 클러스터 c의 좌상단 좌표와 크기 (지도 끝의 클러스터는 작을 수 있음)
+    void clusterRect(int c, int& x0, int& y0, int& h, int& w) const {
+        x0 = (c / ccols_) * size_;
+        y0 = (c % ccols_) * size_;
+        h = std::min(size_, map_->rows() - x0);
+        w = std::min(size_, map_->cols() - y0);
+    }
+
+    int slotOf(int c, int cell) const {
+        const std::vector<int>& nodes = clusters_[c].nodes;
+        return std::find(nodes.begin(), nodes.end(), cell) - nodes.begin();
+    }
+
+    int cellOf(int id) const {
+        int start_id = (int)clusters_.size() * cap_;
+        if (id == start_id) return start_idx_;
+        if (id == start_id + 1) return goal_idx_;
+        return clusters_[id / cap_].nodes[id % cap_];
+    }
+
+    int heuristic(int cell) const {
+        return ManhattanHeuristic()(map_->row(cell), map_->col(cell), map_->row(goal_idx_), map_->col(goal_idx_));
+    }
+
+    // 클러스터 c의 아래쪽 경계 (hborder_)와 오른쪽 경계 (vborder_)의 출입구 계산
+    void buildBorders(int c) {
+        int x0, y0, h, w;
+        clusterRect(c, x0, y0, h, w);
+        hborder_[c].clear();
+        vborder_[c].clear();
+        if (c / ccols_ + 1 < crows_) buildBorder(hborder_[c], x0 + h - 1, y0, 0, 1, w, 1, 0);
+        if (c % ccols_ + 1 < ccols_) buildBorder(vborder_[c], x0, y0 + w - 1, 1, 0, h, 0, 1);
+    }
+
+    // (x, y)부터 (dx, dy) 방향으로 len 칸인 경계를 따라가며, 셀과 (ox, oy)만큼 떨어진 이웃 셀이 모두 비어 있는 구간마다 출입구 추가
+    void buildBorder(std::vector<std::pair<int, int>>& entrances, int x, int y, int dx, int dy, int len, int ox, int oy) {
+        auto add = [&](int i) {
+            int ax = x + dx * i, ay = y + dy * i;
+            entrances.push_back({map_->index(ax, ay), map_->index(ax + ox, ay + oy)});
+        };
+        int run_start = -1;
+        for (int i = 0; i <= len; i++) {
+            int ax = x + dx * i, ay = y + dy * i;
+            bool open = i < len && map_->isFree(ax, ay) && map_->isFree(ax + ox, ay + oy);
+            if (open && run_start < 0) {
+                run_start = i;
+            } else if (!open && run_start >= 0) {
+                int run_end = i - 1;
+                if (run_end - run_start + 1 < kMaxSingleEntrance) {
+                    add((run_start + run_end) / 2);
+                } else {
+                    add(run_start);
+                    add(run_end);
+                }
+                run_start = -1;
+            }
+        }
+    }
+
+    // 네 경계의 출입구로 클러스터 c의 노드 목록과 내부 거리표를 다시 만듦
+    void buildCluster(int c) {
+        Cluster& cl = clusters_[c];
+        cl.nodes.clear();
+        cl.links.clear();
+
+        auto addLink = [&](int cell, int partner) {
+            int s = slotOf(c, cell);
+            if (s == (int)cl.nodes.size()) {
+                cl.nodes.push_back(cell);
+                cl.links.emplace_back();
+            }
+            cl.links[s].push_back(partner);
+        };
+        for (const auto& e : hborder_[c]) addLink(e.first, e.second);
+        for (const auto& e : vborder_[c]) addLink(e.first, e.second);
+        if (c / ccols_ > 0) {
+            for (const auto& e : hborder_[c - ccols_]) addLink(e.second, e.first);
+        }
+        if (c % ccols_ > 0) {
+            for (const auto& e : vborder_[c - 1]) addLink(e.second, e.first);
+        }
+
+        const int k = cl.nodes.size();
+        cl.dist.assign(k * k, kInf);
+        for (int i = 0; i < k; i++) {
+            bfs(c, cl.nodes[i], -1);
+            for (int j = 0; j < k; j++) cl.dist[i * k + j] = localDist(c, cl.nodes[j]);
+        }
+    }
+
+    // 추상 탐색 배열 크기 조정. 노드 id = 클러스터 번호 * cap_ + 클러스터 안의 순번, 마지막 2개는 시점/종점.
+    void resizeSearch() {
+        int cap = 1;
+        for (const Cluster& cl : clusters_) cap = std::max(cap, (int)cl.nodes.size());
+        if (cap <= cap_ && !g_.empty()) return;
+        cap_ = std::max(cap, cap_);
+        int n = (int)clusters_.size() * cap_ + 2;
+        g_.assign(n, kInf);
+        parent_.assign(n, -1);
+        seen_.assign(n, 0);
+        closed_.assign(n, 0);
+        generation_ = 0;
+    }
+
+    void beginSearch() {
+        if (++generation_ == 0) {
+            std::fill(seen_.begin(), seen_.end(), 0);
+            std::fill(closed_.begin(), closed_.end(), 0);
+            generation_ = 1;
+        }
+        open_.clear();
+    }
+
+    void setG(int id, int g, int parent) {
+        seen_[id] = generation_;
+        g_[id] = g;
+        parent_[id] = parent;
+    }
+
+    // 클러스터 c 안에서만 이동하는 BFS. target을 꺼내면 멈춤 (-1이면 클러스터 전체). 확장한 셀 수 반환.
+    // 결과는 클러스터 안의 지역 인덱스 (lx * size_ + ly) 배열에 저장하므로 지도 크기와 관계없이 size_ x size_ 버퍼만 사용.
+    int bfs(int c, int src, int target) {
+        int x0, y0, h, w;
+        clusterRect(c, x0, y0, h, w);
+        if (++lgeneration_ == 0) {
+            std::fill(lseen_.begin(), lseen_.end(), 0);
+            lgeneration_ = 1;
+        }
+
+        int src_local = (map_->row(src) - x0) * size_ + (map_->col(src) - y0);
+        int target_local = target < 0 ? -1 : (map_->row(target) - x0) * size_ + (map_->col(target) - y0);
+        lqueue_.clear();
+        lqueue_.push_back(src_local);
+        lseen_[src_local] = lgeneration_;
+        ldist_[src_local] = 0;
+        lparent_[src_local] = -1;
+
+        int expanded = 0;
+        for (size_t head = 0; head < lqueue_.size(); head++) {
+            int cur = lqueue_[head];
+            expanded++;
+            if (cur == target_local) break;
+
+            int lx = cur / size_, ly = cur % size_;
+            for (int i = 0; i < 4; i++) {
+                int nx = lx + kDirections[i][0], ny = ly + kDirections[i][1];
+                if (nx < 0 || nx >= h || ny < 0 || ny >= w) continue;
+                int next = nx * size_ + ny;
+                if (lseen_[next] == lgeneration_ || !map_->isFree(x0 + nx, y0 + ny)) continue;
+                lseen_[next] = lgeneration_;
+                ldist_[next] = ldist_[cur] + 1;
+                lparent_[next] = cur;
+                lqueue_.push_back(next);
+            }
+        }
+        return expanded;
+    }
+
+    // 마지막 bfs() 결과에서 셀까지 거리. 도달하지 못했으면 kInf
+    int localDist(int c, int cell) const {
+        int x0 = (c / ccols_) * size_, y0 = (c % ccols_) * size_;
+        int l = (map_->row(cell) - x0) * size_ + (map_->col(cell) - y0);
+        return lseen_[l] == lgeneration_ ? ldist_[l] : kInf;
+    }
+
+    // 추상 경로의 한 구간 a -> b를 격자 경로로 펼쳐서 path 뒤에 붙임 (a는 이미 path에 있음)
+    void refineSegment(int a, int b, std::vector<Point>& path) {
+        if (a == b) return;
+        int ax = map_->row(a), ay = map_->col(a), bx = map_->row(b), by = map_->col(b);
+        if (std::abs(ax - bx) + std::abs(ay - by) == 1) {
+            path.push_back({bx, by});
+            return;
+        }
+
+        // 내부 간선: 같은 클러스터 안에서 BFS
+        int c = clusterOf(ax, ay);
+        int x0, y0, h, w;
+        clusterRect(c, x0, y0, h, w);
+        visit_cnt_ += bfs(c, a, b);
+
+        int target = (bx - x0) * size_ + (by - y0);
+        int len = ldist_[target];
+        int base = path.size();
+        path.resize(base + len);
+        int cur = target;
+        for (int i = base + len - 1; i >= base; i--) {
+            path[i] = {x0 + cur / size_, y0 + cur % size_};
+            cur = lparent_[cur];
+        }
+    }
+
+    static constexpr int kDirections[4][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}}; // 동, 남, 서, 북
+
+    const GridMap* map_ = nullptr;
+    int size_ = kDefaultClusterSize;
+    int crows_ = 0, ccols_ = 0;
+
+    std::vector<Cluster> clusters_;
+    std::vector<std::vector<std::pair<int, int>>> hborder_;  // 클러스터 c와 아래 클러스터 사이 출입구 {c 쪽 셀, 아래쪽 셀}
+    std::vector<std::vector<std::pair<int, int>>> vborder_;  // 클러스터 c와 오른쪽 클러스터 사이 출입구 {c 쪽 셀, 오른쪽 셀}
+
+    // 클러스터 안 BFS 버퍼 (size_ x size_)
+    std::vector<int> ldist_, lparent_, lqueue_;
+    std::vector<uint32_t> lseen_;
+    uint32_t lgeneration_ = 0;
+
+    // 추상 그래프 A* 버퍼
+    int cap_ = 0;
+    std::vector<int> g_, parent_;
+    std::vector<uint32_t> seen_, closed_;
+    uint32_t generation_ = 0;
+    HeapOpenList open_;
+
+    // 탐색마다 다시 채우는 시점/종점 연결 정보
+    int start_idx_ = -1, goal_idx_ = -1;
+    std::vector<std::pair<int, int>> start_edges_;   // {노드 id, 거리}
+    std::vector<int> goal_dist_;                     // 종점 클러스터의 노드 순번 -> 종점까지 거리
+    std::vector<int> abstract_path_;
+
+    int visit_cnt_ = 0;
+    int abstract_visit_cnt_ = 0;
+};
+
+#endif
@@ -0,0 +1,317 @@
+#ifndef JPS_PLANNER_H
+#define JPS_PLANNER_H
+
+#include <vector>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+
+#include "grid_map.h"
+#include "grid_policy.h"
+#include "heuristic.h"
+#include "open_list.h"
+
+// Jump Point Search (JPS)
+// 균일 비용 격자에서 A*와 같은 비용의 경로를 찾지만, 직선으로 "점프"하면서 방향을 바꿔야 하는 셀(jump point)만
+// openset에 넣기 때문에 넓은 빈 공간에서 확장하는 노드 수가 크게 줄어듦.
+//
+// Neighborhood: 이동 방향 (FourConnected, EightConnected). grid_policy.h 참고
+// 4방향: 세로 이동이 가로 탐색을 분기하고 (8방향의 대각선 역할), 가로 이동은 강제 이웃이 생길 때만 멈춤.
+// 8방향: 모서리 통과를 허용하지 않는 JPS. 대각선 이동이 두 직선 탐색을 분기함.
+//
+// GridPlanner와 같이 지도는 bind()로 한 번만 연결하고 버퍼는 탐색 간에 재사용함.
+// 4방향은 bind()에서 셀마다 좌우 방향의 다음 정지 셀 (강제 이웃이 있는 셀 또는 장애물)까지의 칸 수를 미리 계산함. (JPS+ 방식)
+// -> 가로 점프는 표 조회 한 번이고, 세로 점프는 이동한 칸 수에 비례 (매 칸마다 행 전체를 훑지 않음).
+//    표는 셀당 4 byte이고 지도의 장애물에 따라 정해지므로, 셀을 바꾼 뒤에는 bind()를 다시 호출해야 함.
+template <class Neighborhood = FourConnected>
+class BasicJpsPlanner {
+    static_assert(Neighborhood::kCount == 4 || Neighborhood::kCount == 8, "JPS는 4방향 또는 8방향만 지원");
+
+public:
+    BasicJpsPlanner() = default;
+
+    explicit BasicJpsPlanner(const GridMap& map) {
+        bind(map);
+    }
+
+    void bind(const GridMap& map) {
+        map_ = &map;
+        stride_ = map.stride();
+        int cells = map.cellCount();
+        if (cells != (int)g_.size()) {
+            g_.assign(cells, INT_MAX);
+            parent_.assign(cells, -1);
+            seen_.assign(cells, 0);
+            closed_.assign(cells, 0);
+            generation_ = 0;
+        }
+        if constexpr (kFour) buildRuns();
+    }
+
+    // JPS 탐색
+    // path에는 jump point 사이를 채운 전체 셀 경로를 저장하므로 GridPlanner의 A* 결과와 같은 형식.
+    // Heuristic: 4방향은 ManhattanHeuristic, 8방향은 OctileHeuristic 단위에 맞는 함수를 사용.
+    template <class Heuristic = typename Neighborhood::DefaultHeuristic>
+    bool jumpPointSearch(Point start, Point goal, std::vector<Point>& path, Heuristic heuristic = Heuristic()) {
+        if (++generation_ == 0) {
+            std::fill(seen_.begin(), seen_.end(), 0);
+            std::fill(closed_.begin(), closed_.end(), 0);
+            generation_ = 1;
+        }
+        open_.clear();
+        path.clear();
+        visit_cnt_ = 0;
+        path_cost_ = -1;
+        if (!map_->isFree(start.x, start.y) || !map_->isFree(goal.x, goal.y)) return false;
+
+        const int start_idx = map_->index(start.x, start.y);
+        goal_ = map_->index(goal.x, goal.y);
+        setG(start_idx, 0, -1);
+        open_.push(heuristic(start.x, start.y, goal.x, goal.y), start_idx);
+
+        while (!open_.empty()) {
+            int current = open_.pop();
+            if (isClosed(current)) continue;
+            closed_[current] = generation_;
+            visit_cnt_++;
+
+            if (current == goal_) {
+                path_cost_ = g_[current];
+                buildPath(current, path);
+                return true;
+            }
+
+            // 가지치기한 이웃 방향마다 점프하여 다음 jump point를 찾음
+            int n = successorDirections(current);
+            for (int i = 0; i < n; i++) {
+                int jp = jump(current, dirs_[i][0], dirs_[i][1]);
+                if (jp == -1 || isClosed(jp)) continue;
+
+                Point p = map_->toPoint(jp);
+                int new_g = g_[current] + distance(current, jp);
+                if (new_g >= g(jp)) continue;
+
+                setG(jp, new_g, current);
+                open_.push(new_g + heuristic(p.x, p.y, goal.x, goal.y), jp);
+            }
+        }
+        return false;
+    }
+
+    // 마지막 탐색에서 확장한 jump point인지 확인
+    bool isVisited(int x, int y) const { return isClosed(map_->index(x, y)); }
+
+    // 마지막 탐색에서 확장한 jump point 수
+    int visitCount() const { return visit_cnt_; }
+
+    // 마지막 탐색 경로의 비용 (4방향: 이동 칸 수, 8방향: 직선 10 / 대각선 14). 경로가 없으면 -1
+    int pathCost() const { return path_cost_; }
+
+private:
+    static int sign(int v) { return (v > 0) - (v < 0); }
+
+    bool free(int idx) const { return map_->isFree(idx); }
+    bool isClosed(int idx) const { return closed_[idx] == generation_; }
+    int g(int idx) const { return seen_[idx] == generation_ ? g_[idx] : INT_MAX; }
+
+    void setG(int idx, int g, int parent) {
+        seen_[idx] = generation_;
+        g_[idx] = g;
+        parent_[idx] = parent;
+    }
+
+    static constexpr bool kFour = Neighborhood::kCount == 4;
+
+    // 두 jump point 사이의 비용. 사이 구간은 항상 직선 또는 대각선.
+    int distance(int a, int b) const {
+        int dx = std::abs(map_->row(a) - map_->row(b)), dy = std::abs(map_->col(a) - map_->col(b));
+        int diagonal = std::min(dx, dy);
+        return Neighborhood::kStraightCost * (dx + dy - 2 * diagonal) + Neighborhood::kDiagonalCost * diagonal;
+    }
+
+    int jump(int idx, int dx, int dy) const {
+        if constexpr (kFour) return jump4(idx, dx, dy);
+        else return jump8(idx, dx, dy);
+    }
+
+    // 현재 셀에서 탐색할 방향을 dirs_에 저장하고 개수를 반환. (이웃 가지치기)
+    int successorDirections(int idx) {
+        int n = 0;
+        auto add = [&](int dx, int dy) {
+            dirs_[n][0] = dx;
+            dirs_[n][1] = dy;
+            n++;
+        };
+
+        int parent = parent_[idx];
+        if (parent == -1) {
+            // 시점: 모든 방향
+            add(0, 1); add(1, 0); add(0, -1); add(-1, 0);
+            if constexpr (!kFour) {
+                for (int dx = -1; dx <= 1; dx += 2) {
+                    for (int dy = -1; dy <= 1; dy += 2) {
+                        if (free(idx + dx * stride_) && free(idx + dy)) add(dx, dy);
+                    }
+                }
+            }
+            return n;
+        }
+
+        int dx = sign(map_->row(idx) - map_->row(parent));
+        int dy = sign(map_->col(idx) - map_->col(parent));
+
+        if constexpr (kFour) {
+            if (dx != 0) {
+                // 세로 이동: 계속 진행 + 가로 양방향
+                add(dx, 0); add(0, 1); add(0, -1);
+            } else {
+                // 가로 이동: 계속 진행 + 강제 이웃 (뒤쪽 대각선이 막힌 세로 방향)
+                add(0, dy);
+                if (free(idx + stride_) && !free(idx - dy + stride_)) add(1, 0);
+                if (free(idx - stride_) && !free(idx - dy - stride_)) add(-1, 0);
+            }
+            return n;
+        }
+
+        if (dx != 0 && dy != 0) {
+            // 대각선 이동: 두 직선 성분 + 대각선
+            bool free_x = free(idx + dx * stride_), free_y = free(idx + dy);
+            if (free_y) add(0, dy);
+            if (free_x) add(dx, 0);
+            if (free_x && free_y) add(dx, dy);
+        } else {
+            // 직선 이동: 진행 방향, 양옆, 진행 방향 쪽 대각선
+            int px = dy != 0 ? 1 : 0, py = dx != 0 ? 1 : 0;   // 진행 방향에 수직인 단위 벡터
+            bool next = free(idx + dx * stride_ + dy);
+            bool side1 = free(idx + px * stride_ + py), side2 = free(idx - px * stride_ - py);
+            if (next) {
+                add(dx, dy);
+                if (side1) add(dx + px, dy + py);
+                if (side2) add(dx - px, dy - py);
+            }
+            if (side1) add(px, py);
+            if (side2) add(-px, -py);
+        }
+        return n;
+    }
+
+    // dy 방향으로 들어온 셀 idx에 강제 이웃이 있는지 (뒤쪽 대각선이 막힌 세로 방향 이웃)
+    bool forcedHorizontal(int idx, int dy) const {
+        return (free(idx + stride_) && !free(idx - dy + stride_)) || (free(idx - stride_) && !free(idx - dy - stride_));
+    }
+
+    // 셀마다 dy 방향의 다음 정지 셀까지의 칸 수 (east_: dy = 1, west_: dy = -1). 테두리 행, 열은 0
+    // 65535칸보다 먼 셀은 65535로 저장하고 조회할 때 이어서 찾음.
+    void buildRuns() {
+        const int rows = map_->rows() + 2;
+        east_.assign(map_->cellCount(), 0);
+        west_.assign(map_->cellCount(), 0);
+        auto stop = [&](int idx, int dy) { return !free(idx) || forcedHorizontal(idx, dy); };
+        for (int x = 1; x < rows - 1; x++) {
+            const int base = x * stride_;
+            for (int y = stride_ - 2; y >= 0; y--) {
+                const int idx = base + y;
+                east_[idx] = stop(idx + 1, 1) ? 1 : std::min(east_[idx + 1] + 1, 0xFFFF);
+            }
+            for (int y = 1; y < stride_; y++) {
+                const int idx = base + y;
+                west_[idx] = stop(idx - 1, -1) ? 1 : std::min(west_[idx - 1] + 1, 0xFFFF);
+            }
+        }
+    }
+
+    // 4방향 가로 점프: 막히면 -1, 목표 또는 강제 이웃이 있는 셀에서 멈춤
+    // 표에서 다음 정지 셀을 찾고, 목표가 같은 행의 그 사이에 있으면 목표를 반환.
+    int jumpHorizontal(int idx, int dy) const {
+        const std::vector<uint16_t>& run = dy > 0 ? east_ : west_;
+        const bool goal_row = goal_ / stride_ == idx / stride_;
+        while (true) {
+            const int next = idx + dy * run[idx];
+            if (goal_row && (goal_ - idx) * dy > 0 && (next - goal_) * dy >= 0) return goal_;
+            if (!free(next)) return -1;
+            if (forcedHorizontal(next, dy)) return next;
+            idx = next;   // 65535칸보다 긴 빈 구간
+        }
+    }
+
+    // 4방향 점프. 세로 이동 중에는 매 칸마다 가로 점프를 분기하여 jump point가 있는지 확인
+    int jump4(int idx, int dx, int dy) const {
+        if (dx == 0) return jumpHorizontal(idx, dy);
+        int step = dx * stride_;
+        while (true) {
+            idx += step;
+            if (!free(idx)) return -1;
+            if (idx == goal_) return idx;
+            if (jumpHorizontal(idx, 1) != -1 || jumpHorizontal(idx, -1) != -1) return idx;
+        }
+    }
+
+    // 8방향 직선 점프
+    int jumpStraight(int idx, int dx, int dy) const {
+        int step = dx * stride_ + dy;
+        int side = dx != 0 ? 1 : stride_;   // 진행 방향에 수직인 인덱스 차이
+        while (true) {
+            idx += step;
+            if (!free(idx)) return -1;
+            if (idx == goal_) return idx;
+            if ((free(idx + side) && !free(idx - step + side)) ||
+                (free(idx - side) && !free(idx - step - side))) return idx;
+        }
+    }
+
+    // 8방향 점프. 대각선 이동 중에는 매 칸마다 두 직선 점프를 분기
+    int jump8(int idx, int dx, int dy) const {
+        if (dx == 0 || dy == 0) return jumpStraight(idx, dx, dy);
+        int step = dx * stride_ + dy;
+        while (true) {
+            idx += step;
+            if (!free(idx)) return -1;
+            if (idx == goal_) return idx;
+            if (jumpStraight(idx, dx, 0) != -1 || jumpStraight(idx, 0, dy) != -1) return idx;
+            // 다음 대각선 칸으로 가려면 양옆 셀이 모두 비어 있어야 함
+            if (!free(idx + dx * stride_) || !free(idx + dy)) return -1;
+        }
+    }
+
+    // jump point를 parent로 역추적하면서 사이 구간의 셀을 채움
+    void buildPath(int goal_idx, std::vector<Point>& path) const {
+        int idx = goal_idx;
+        for (; parent_[idx] != -1; idx = parent_[idx]) {
+            Point p = map_->toPoint(idx), q = map_->toPoint(parent_[idx]);
+            int sx = sign(q.x - p.x), sy = sign(q.y - p.y);
+            while (p != q) {
+                path.push_back(p);
+                p.x += sx * (p.x != q.x);
+                p.y += sy * (p.y != q.y);
+            }
+        }
+        // 마지막으로 남은 idx가 시점
+        path.push_back(map_->toPoint(idx));
+        std::reverse(path.begin(), path.end());
+    }
+
+    const GridMap* map_ = nullptr;
+    int stride_ = 0;
+    int goal_ = -1;
+    int dirs_[8][2] = {};
+
+    std::vector<int> g_;                 // 시점->jump point 최소 비용
+    std::vector<int> parent_;            // 이전 jump point의 인덱스. 시점은 -1
+    std::vector<uint32_t> seen_;         // g_/parent_ 값이 기록된 세대
+    std::vector<uint32_t> closed_;       // 확장이 끝난 세대
+    uint32_t generation_ = 0;
+    std::vector<uint16_t> east_, west_;  // 4방향: 좌우 다음 정지 셀까지의 칸 수 (buildRuns)
+
+    HeapOpenList open_;
+    int visit_cnt_ = 0;
+    int path_cost_ = -1;
+};
+
+// 4방향 (이동 비용 1) JPS. GridPlanner와 같은 비용의 경로
+using JpsPlanner4 = BasicJpsPlanner<FourConnected>;
+
+// 8방향 (직선 10, 대각선 14) JPS. GridPlanner8과 같은 비용의 경로
+using JpsPlanner8 = BasicJpsPlanner<EightConnected>;
+
+#endif
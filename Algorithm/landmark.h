@@ -0,0 +1,284 @@
+#ifndef LANDMARK_H
+#define LANDMARK_H
+
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "grid_map.h"
+#include "grid_planner.h"
+#include "distance_field.h"
+#include "heuristic.h"
+
+// 랜드마크 (ALT: A*, Landmarks, Triangle inequality) 휴리스틱
+// 지도가 오래 바뀌지 않을 때, 미리 랜드마크 몇 개를 고르고 모든 셀 -> 랜드마크 최단 거리를 다익스트라(distanceField)로 계산해 둠.
+// 삼각 부등식 d(v, L) <= d(v, t) + d(t, L) 에서 d(v, t) >= d(v, L) - d(t, L) 이므로,
+// 모든 랜드마크에 대한 최대값은 허용 가능(admissible)하고 일관적(consistent)인 휴리스틱.
+// 벽을 돌아가야 하는 미로에서는 유클리디안/맨해튼보다 훨씬 실제 거리에 가까우므로 A*의 확장 수가 크게 줄어듦.
+//
+// 사용: 전처리 한 번 (build + save) -> 실행 시 load(file, map) -> planner.aStarAlgorithm(s, g, path, AltHeuristic(table, map))
+// 거리는 지도의 장애물과 셀 비용으로 정해지므로, 표에 지도 해시를 저장해 두고 load가 읽을 지도와 비교함. (matches)
+// 표는 build / load에 사용한 지도 객체에 연결되고, AltHeuristic은 연결된 지도에서만 표를 사용함.
+// 거리는 build에 사용한 플래너의 비용 단위이므로 같은 종류 (Neighborhood, CostModel)의 플래너에 사용해야 함.
+// 셀 비용이 없는 지도 (UniformCost)는 거리가 대칭이므로 d(t, L) - d(v, L)도 하한으로 함께 사용.
+//
+// 파일 구조 (little endian): LandmarkFileHeader (32 byte), 랜드마크 좌표 (uint32 x, y) x count,
+//   map_hash: 지도 해시 (mapHash, 장애물 + 셀 비용)
+//   거리 표: 셀 (x * cols + y) 마다 랜드마크 count개의 거리 (entry_bytes = 2 또는 4 byte)
+// 최대 거리가 65534 이하면 2 byte로 저장함. 도달할 수 없는 셀은 0xFFFF (0xFFFFFFFF).
+// 한 셀의 랜드마크 거리가 연속해 있으므로 휴리스틱 계산 한 번에 캐시 라인 1 ~ 2개만 읽음.
+
+struct LandmarkFileHeader {
+    char magic[4];       // "ALTH"
+    uint32_t version;
+    uint32_t rows, cols;
+    uint32_t count;      // 랜드마크 수
+    uint32_t entry_bytes;
+    uint32_t flags;
+    uint32_t map_hash;   // 표를 만든 지도의 mapHash (version 1에서는 reserved)
+};
+
+static constexpr char kLandmarkMagic[4] = {'A', 'L', 'T', 'H'};
+static constexpr uint32_t kLandmarkVersion = 2;
+static constexpr uint32_t kLandmarkSymmetric = 1;
+
+class LandmarkTable {
+public:
+    LandmarkTable() = default;
+
+    // 랜드마크 count개를 고르고 거리 표를 계산. (다익스트라 count + 1번)
+    // 선택: 첫 랜드마크는 seed에서 가장 먼 셀, 이후에는 이미 고른 랜드마크들과의 최소 거리가 가장 큰 셀 (farthest point).
+    // 지도 가장자리, 막다른 곳에 퍼지도록 고르므로 적은 수로도 하한이 좋아짐.
+    // 랜드마크는 seed (기본: 첫 번째 이동 가능한 셀)와 연결된 영역에서만 고름. 다른 영역의 셀은 휴리스틱이 0.
+    template <class Neighborhood, class CostModel, class OpenList>
+    bool build(BasicGridPlanner<Neighborhood, CostModel, OpenList>& planner, int count, Point seed = {-1, -1}) {
+        const GridMap& map = planner.map();
+        rows_ = map.rows();
+        cols_ = map.cols();
+        map_ = &map;
+        map_hash_ = mapHash(map);
+        symmetric_ = std::is_same<CostModel, UniformCost>::value;
+        landmarks_.clear();
+
+        if (seed.x < 0) seed = firstFree(map);
+        if (count <= 0 || seed.x < 0 || !map.isFree(seed.x, seed.y)) {
+            count_ = 0;
+            return false;
+        }
+
+        // 모든 셀 -> 가장 가까운 랜드마크 거리 (처음에는 seed 기준)
+        DistanceField field;
+        planner.distanceField(seed, field);
+        std::vector<int> nearest(rows_ * cols_);
+        for (int x = 0; x < rows_; x++) {
+            for (int y = 0; y < cols_; y++) nearest[x * cols_ + y] = field.distance(x, y);
+        }
+
+        std::vector<std::vector<int>> distances;
+        for (int k = 0; k < count; k++) {
+            // 도달 가능한 셀 중 가장 먼 셀
+            int best = -1;
+            for (int i = 0; i < rows_ * cols_; i++) {
+                if (nearest[i] == DistanceField::kUnreachable || nearest[i] == 0) continue;
+                if (best == -1 || nearest[i] > nearest[best]) best = i;
+            }
+            if (best == -1) break;   // 셀이 랜드마크보다 적음
+            Point landmark = {best / cols_, best % cols_};
+            landmarks_.push_back(landmark);
+
+            planner.distanceField(landmark, field);
+            distances.emplace_back(rows_ * cols_);
+            std::vector<int>& d = distances.back();
+            for (int x = 0; x < rows_; x++) {
+                for (int y = 0; y < cols_; y++) {
+                    int i = x * cols_ + y;
+                    d[i] = field.distance(x, y);
+                    if (k == 0 || d[i] < nearest[i]) nearest[i] = d[i];
+                }
+            }
+        }
+        count_ = landmarks_.size();
+
+        // 표 크기 결정 후 셀 단위로 모아서 저장
+        int max_distance = 0;
+        for (auto& d : distances) {
+            for (int v : d) {
+                if (v != DistanceField::kUnreachable && v > max_distance) max_distance = v;
+            }
+        }
+        wide_ = max_distance >= 0xFFFF;
+        table16_.clear();
+        table32_.clear();
+        if (wide_) table32_.resize((size_t)rows_ * cols_ * count_);
+        else table16_.resize((size_t)rows_ * cols_ * count_);
+        for (int i = 0; i < rows_ * cols_; i++) {
+            for (int k = 0; k < count_; k++) {
+                int v = distances[k][i];
+                if (wide_) table32_[(size_t)i * count_ + k] = v == DistanceField::kUnreachable ? kUnreachable32 : v;
+                else table16_[(size_t)i * count_ + k] = v == DistanceField::kUnreachable ? kUnreachable16 : v;
+            }
+        }
+        return count_ > 0;
+    }
+
+    bool save(const char* file_name) const {
+        LandmarkFileHeader header = {};
+        std::memcpy(header.magic, kLandmarkMagic, 4);
+        header.version = kLandmarkVersion;
+        header.rows = rows_;
+        header.cols = cols_;
+        header.count = count_;
+        header.entry_bytes = wide_ ? 4 : 2;
+        header.flags = symmetric_ ? kLandmarkSymmetric : 0;
+        header.map_hash = map_hash_;
+
+        std::vector<uint32_t> points;
+        for (Point p : landmarks_) {
+            points.push_back(p.x);
+            points.push_back(p.y);
+        }
+
+        FILE* fp = std::fopen(file_name, "wb");
+        if (!fp) return false;
+        size_t entries = (size_t)rows_ * cols_ * count_;
+        bool ok = std::fwrite(&header, sizeof(header), 1, fp) == 1 &&
+                  std::fwrite(points.data(), sizeof(uint32_t), points.size(), fp) == points.size() &&
+                  (wide_ ? std::fwrite(table32_.data(), 4, entries, fp) : std::fwrite(table16_.data(), 2, entries, fp)) == entries;
+        return std::fclose(fp) == 0 && ok;
+    }
+
+    // map: 표를 사용할 지도 (표보다 오래 살아 있어야 함).
+    // 파일이 없거나 형식이 맞지 않거나, map과 다른 지도 (크기, 장애물, 셀 비용)로 만든 표면 false 반환하고 표는 비워 둠.
+    bool load(const char* file_name, const GridMap& map) {
+        *this = LandmarkTable();
+        FILE* fp = std::fopen(file_name, "rb");
+        if (!fp) return false;
+
+        LandmarkFileHeader header;
+        bool ok = std::fread(&header, sizeof(header), 1, fp) == 1 && std::memcmp(header.magic, kLandmarkMagic, 4) == 0 &&
+                  header.version == kLandmarkVersion && (header.entry_bytes == 2 || header.entry_bytes == 4) &&
+                  header.rows < (1u << 16) && header.cols < (1u << 16) && header.count < 256;
+        if (ok) {
+            std::vector<uint32_t> points(2 * header.count);
+            size_t entries = (size_t)header.rows * header.cols * header.count;
+            wide_ = header.entry_bytes == 4;
+            if (wide_) table32_.resize(entries);
+            else table16_.resize(entries);
+            ok = std::fread(points.data(), sizeof(uint32_t), points.size(), fp) == points.size() &&
+                 (wide_ ? std::fread(table32_.data(), 4, entries, fp) : std::fread(table16_.data(), 2, entries, fp)) == entries;
+            for (size_t i = 0; ok && i < header.count; i++) landmarks_.push_back({(int)points[2 * i], (int)points[2 * i + 1]});
+        }
+        std::fclose(fp);
+        if (!ok) {
+            *this = LandmarkTable();
+            return false;
+        }
+        rows_ = header.rows;
+        cols_ = header.cols;
+        count_ = header.count;
+        symmetric_ = header.flags & kLandmarkSymmetric;
+        map_hash_ = header.map_hash;
+        if (!matches(map)) {
+            *this = LandmarkTable();
+            return false;
+        }
+        map_ = &map;
+        return true;
+    }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int count() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    // 비어 있지 않고 map과 크기, 장애물, 셀 비용이 같은 지도로 만든 표인지 (해시 계산, O(셀 수))
+    bool matches(const GridMap& map) const {
+        return count_ > 0 && rows_ == map.rows() && cols_ == map.cols() && map_hash_ == mapHash(map);
+    }
+
+    // build / load에 사용한 지도인지 (O(1)). AltHeuristic이 탐색마다 확인함
+    bool boundTo(const GridMap& map) const { return count_ > 0 && map_ == &map; }
+
+    // 지도 해시 (FNV-1a). 셀마다 장애물이면 0, 이동 가능하면 셀 비용 (비용 배열이 없으면 1)
+    static uint32_t mapHash(const GridMap& map) {
+        uint32_t hash = 2166136261u;
+        for (int x = 0; x < map.rows(); x++) {
+            for (int y = 0; y < map.cols(); y++) {
+                const int idx = map.index(x, y);
+                hash = (hash ^ (map.isFree(idx) ? (uint32_t)map.cost(idx) : 0u)) * 16777619u;
+            }
+        }
+        return hash;
+    }
+    const std::vector<Point>& landmarks() const { return landmarks_; }
+
+    // 표 크기 (byte)
+    size_t bytes() const { return table16_.size() * 2 + table32_.size() * 4; }
+
+    // (x1, y1) -> (x2, y2) 최단 거리의 하한
+    // 플래너는 지도 밖 이웃의 휴리스틱도 한 번에 계산한 뒤 버리므로, 지도 밖 좌표는 0을 반환.
+    int lowerBound(int x1, int y1, int x2, int y2) const {
+        if ((unsigned)x1 >= (unsigned)rows_ || (unsigned)y1 >= (unsigned)cols_ ||
+            (unsigned)x2 >= (unsigned)rows_ || (unsigned)y2 >= (unsigned)cols_) return 0;
+        const size_t from = (size_t)(x1 * cols_ + y1) * count_, to = (size_t)(x2 * cols_ + y2) * count_;
+        return wide_ ? bound(table32_.data() + from, table32_.data() + to, kUnreachable32)
+                     : bound(table16_.data() + from, table16_.data() + to, kUnreachable16);
+    }
+
+private:
+    static constexpr uint16_t kUnreachable16 = 0xFFFF;
+    static constexpr uint32_t kUnreachable32 = 0xFFFFFFFF;
+
+    template <class Entry>
+    int bound(const Entry* from, const Entry* to, Entry unreachable) const {
+        int best = 0;
+        for (int k = 0; k < count_; k++) {
+            // 한쪽만 랜드마크에 도달할 수 있으면 다른 영역이므로 그 랜드마크는 정보가 없음 (경로가 없으면 A*가 알아서 실패)
+            if (from[k] == unreachable || to[k] == unreachable) continue;
+            int diff = (int)from[k] - (int)to[k];
+            if (symmetric_ && -diff > diff) diff = -diff;
+            if (diff > best) best = diff;
+        }
+        return best;
+    }
+
+    static Point firstFree(const GridMap& map) {
+        for (int x = 0; x < map.rows(); x++) {
+            for (int y = 0; y < map.cols(); y++) {
+                if (map.isFree(x, y)) return {x, y};
+            }
+        }
+        return {-1, -1};
+    }
+
+    int rows_ = 0, cols_ = 0, count_ = 0;
+    const GridMap* map_ = nullptr;   // build / load에 사용한 지도
+    uint32_t map_hash_ = 0;
+    bool symmetric_ = true;
+    bool wide_ = false;
+    std::vector<Point> landmarks_;
+    std::vector<uint16_t> table16_;   // 최대 거리가 65534 이하일 때
+    std::vector<uint32_t> table32_;   // 그 외
+};
+
+// aStarAlgorithm에 넘기는 휴리스틱 함수 객체. 표를 참조만 하므로 복사 비용 없음 (표는 휴리스틱보다 오래 살아 있어야 함)
+// Base: 함께 사용할 기존 휴리스틱. 두 하한의 최대값도 허용 가능하므로, 랜드마크가 먼 방향에서는 Base 값을 사용.
+//   예: AltHeuristic(table, map) (랜드마크만), AltHeuristic(table, map, ManhattanHeuristic()) (4방향, 비용 1)
+// map: 탐색할 지도. 표가 이 지도에 연결되어 있지 않으면 (boundTo() == false) 표를 사용하지 않고 Base 값만 사용함.
+template <class Base = ZeroHeuristic>
+struct AltHeuristic {
+    const LandmarkTable* table;   // 지도와 맞지 않으면 nullptr
+    Base base;
+
+    AltHeuristic(const LandmarkTable& landmarks, const GridMap& map, Base base_heuristic = Base())
+        : table(landmarks.boundTo(map) ? &landmarks : nullptr), base(base_heuristic) {}
+
+    int operator()(int x1, int y1, int x2, int y2) const {
+        int h = table ? table->lowerBound(x1, y1, x2, y2) : 0, b = base(x1, y1, x2, y2);
+        return h > b ? h : b;
+    }
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef MAP_FILE_H
+#define MAP_FILE_H
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include <memory>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "grid_map.h"
+
+// 이진 지도 파일 (.gmap)
+// 파일 내용이 GridMap의 메모리 배치와 같으므로, 읽을 때 파싱이나 복사 없이 mmap한 메모리를 그대로 지도로 사용함.
+// -> 큰 지도도 여는 시간은 파일 크기와 거의 관계없고, 실제로 접근하는 페이지만 읽힘.
+//    (비용 배열이 있으면 0인 비용이 없는지 한 번 훑으므로 비용 배열은 모두 읽힘)
+// -> 같은 파일을 여는 여러 프로세스가 페이지 캐시의 한 사본을 공유함.
+//
+// 파일 구조 (little endian):
+//   MapFileHeader (32 byte)
+//   셀 배열: 테두리 포함 (rows + 2) x (cols + 2) byte (GridMap::kFree / kBlocked)
+//   비용 배열: 셀 배열과 같은 크기 (flags에 kMapHasCosts가 있을 때만)
+// 셀은 bit 단위로 압축하지 않고 byte로 저장함. 플래너가 셀 인덱스로 바로 읽기 때문.
+//
+// MAP_PRIVATE로 매핑하므로 setBlocked()/setCost()로 바꾼 내용은 그 프로세스에만 보이고 파일에는 쓰이지 않음.
+// (바뀐 페이지만 복사됨, copy-on-write)
+// 텍스트/PGM 지도는 Tools/map_convert.cpp로 변환.
+
+struct MapFileHeader {
+    char magic[4];       // "GMAP"
+    uint32_t version;
+    uint32_t rows, cols;
+    uint32_t flags;
+    uint32_t reserved[3];
+};
+
+static constexpr char kMapMagic[4] = {'G', 'M', 'A', 'P'};
+static constexpr uint32_t kMapVersion = 1;
+static constexpr uint32_t kMapHasCosts = 1;
+
+// GridMap을 파일로 저장. 모든 셀의 비용이 1이면 비용 배열은 저장하지 않음.
+inline bool saveMapFile(const char* file_name, const GridMap& map) {
+    MapFileHeader header = {};
+    std::memcpy(header.magic, kMapMagic, 4);
+    header.version = kMapVersion;
+    header.rows = map.rows();
+    header.cols = map.cols();
+
+    const uint8_t* costs = map.costData();
+    bool has_costs = false;
+    for (int i = 0; costs && i < map.cellCount() && !has_costs; i++) has_costs = costs[i] != 1;
+    if (has_costs) header.flags |= kMapHasCosts;
+
+    FILE* fp = std::fopen(file_name, "wb");
+    if (!fp) return false;
+    bool ok = std::fwrite(&header, sizeof(header), 1, fp) == 1 &&
+              std::fwrite(map.data(), 1, map.cellCount(), fp) == (size_t)map.cellCount() &&
+              (!has_costs || std::fwrite(costs, 1, map.cellCount(), fp) == (size_t)map.cellCount());
+    return std::fclose(fp) == 0 && ok;
+}
+
+// 파일을 mmap해서 map에 연결. 매핑은 map (과 그 복사본)이 사라질 때 해제됨.
+// 파일이 없거나 형식이 맞지 않으면 false 반환하고 map은 바꾸지 않음.
+inline bool loadMapFile(const char* file_name, GridMap& map) {
+    int fd = ::open(file_name, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(MapFileHeader)) {
+        ::close(fd);
+        return false;
+    }
+    size_t length = st.st_size;
+    void* addr = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);   // 매핑은 fd를 닫아도 유지됨
+    if (addr == MAP_FAILED) return false;
+    std::shared_ptr<void> owner(addr, [length](void* p) { ::munmap(p, length); });
+
+    // 헤더와 크기 검사
+    const MapFileHeader* header = static_cast<const MapFileHeader*>(addr);
+    if (std::memcmp(header->magic, kMapMagic, 4) != 0 || header->version != kMapVersion) return false;
+    // 셀 수 (테두리 포함)가 int 범위를 넘는 헤더는 int로 바꾸기 전에 거름
+    const uint64_t padded = ((uint64_t)header->rows + 2) * ((uint64_t)header->cols + 2);
+    if (padded > (uint64_t)INT_MAX) return false;
+    int rows = header->rows, cols = header->cols;
+    size_t count = padded;
+    bool has_costs = header->flags & kMapHasCosts;
+    if (length != sizeof(MapFileHeader) + count * (has_costs ? 2 : 1)) return false;
+
+    uint8_t* cells = static_cast<uint8_t*>(addr) + sizeof(MapFileHeader);
+    uint8_t* costs = has_costs ? cells + count : nullptr;
+
+    // 플래너는 테두리가 장애물이라고 가정하므로 테두리만 확인 (O(rows + cols))
+    int stride = cols + 2;
+    for (int y = 0; y < stride; y++) {
+        if (cells[y] != GridMap::kBlocked || cells[(rows + 1) * stride + y] != GridMap::kBlocked) return false;
+    }
+    for (int x = 0; x < rows + 2; x++) {
+        if (cells[x * stride] != GridMap::kBlocked || cells[x * stride + stride - 1] != GridMap::kBlocked) return false;
+    }
+
+    // 비용 0은 setCost()로 만들 수 없는 값이고, 0 비용 이동이 있으면 버킷 폭 계산 등이 깨짐
+    if (costs && std::memchr(costs, 0, count)) return false;
+
+    map = GridMap::view(rows, cols, cells, costs, std::move(owner));
+    return true;
+}
+
+#endif
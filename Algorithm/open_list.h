@@ -0,0 +1,152 @@
+#ifndef OPEN_LIST_H
+#define OPEN_LIST_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+
+// openset(우선순위 큐) 구현
+// 두 구현 모두 같은 인터페이스를 가지며, 플래너의 템플릿 인자로 선택함.
+//   push(priority, idx): 셀 idx를 우선순위 priority로 추가
+//   pop(): 우선순위가 가장 작은 셀 idx를 꺼냄
+//   topPriority(): 가장 작은 우선순위 (비어 있지 않을 때만 호출)
+//   capacityBytes(): 저장소가 잡고 있는 메모리 (byte). 탐색 통계용
+// 저장소는 clear() 후에도 capacity를 유지하므로 반복 탐색 시 추가 할당이 없음.
+
+// 이진 힙 (min heap). push/pop O(log n)
+// 우선순위가 정수가 아니거나 단조 증가하지 않는 경우에도 사용 가능.
+class HeapOpenList {
+public:
+    void clear() { heap_.clear(); }
+    bool empty() const { return heap_.empty(); }
+    size_t size() const { return heap_.size(); }
+
+    void push(int priority, int idx) {
+        heap_.push_back({priority, idx});
+        std::push_heap(heap_.begin(), heap_.end(), Compare());
+    }
+
+    int topPriority() const { return heap_.front().first; }
+    size_t capacityBytes() const { return heap_.capacity() * sizeof(heap_[0]); }
+
+    int pop() {
+        std::pop_heap(heap_.begin(), heap_.end(), Compare());
+        int idx = heap_.back().second;
+        heap_.pop_back();
+        return idx;
+    }
+
+private:
+    // {priority, idx} 비교. min heap 구현
+    struct Compare {
+        bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const {
+            return a.first > b.first;
+        }
+    };
+
+    std::vector<std::pair<int, int>> heap_;
+};
+
+// 버킷 큐 (원형 버킷). push/pop O(1)
+// 이동 비용과 휴리스틱이 작은 정수일 때 사용. 같은 우선순위 안에서는 나중에 넣은 셀이 먼저 나옴 (LIFO).
+// 큐 안의 우선순위 범위 (최대 - 최소)가 버킷 수보다 커지면 버킷 수를 2배로 늘림.
+// 격자 탐색에서는 이 범위가 (최대 이동 비용 + 휴리스틱 변화량) 정도로 작게 유지됨.
+// 버킷마다 vector를 두지 않고, 모든 항목을 하나의 배열(entries_)에 두고 버킷별 연결 리스트로 묶음.
+// -> 어느 버킷에 쌓이든 같은 저장소를 재사용하므로 반복 탐색 시 추가 할당이 없음.
+class BucketOpenList {
+public:
+    explicit BucketOpenList(int buckets = 64) {
+        int n = 1;
+        while (n < buckets) n <<= 1;
+        heads_.assign(n, -1);
+        mask_ = n - 1;
+    }
+
+    void clear() {
+        if (count_ > 0 || !entries_.empty()) {
+            std::fill(heads_.begin(), heads_.end(), -1);
+        }
+        entries_.clear();
+        free_ = -1;
+        count_ = 0;
+    }
+
+    bool empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+    size_t capacityBytes() const { return heads_.capacity() * sizeof(int) + entries_.capacity() * sizeof(Entry); }
+
+    void push(int priority, int idx) {
+        if (count_ == 0) {
+            min_ = max_ = priority;
+        } else {
+            int lo = std::min(min_, priority), hi = std::max(max_, priority);
+            if (hi - lo > mask_) grow(hi - lo);
+            min_ = lo;
+            max_ = hi;
+        }
+
+        // 비어 있는 항목을 재사용하고, 없으면 저장소 끝에 추가
+        int e = free_;
+        if (e != -1) {
+            free_ = entries_[e].next;
+            entries_[e].idx = idx;
+        } else {
+            e = entries_.size();
+            entries_.push_back({idx, -1});
+        }
+        int& head = heads_[priority & mask_];
+        entries_[e].next = head;
+        head = e;
+        count_++;
+    }
+
+    int topPriority() {
+        // 비어 있지 않은 가장 작은 우선순위의 버킷까지 이동
+        while (heads_[min_ & mask_] == -1) min_++;
+        return min_;
+    }
+
+    int pop() {
+        topPriority();
+        int& head = heads_[min_ & mask_];
+        int e = head;
+        head = entries_[e].next;
+        entries_[e].next = free_;
+        free_ = e;
+        count_--;
+        return entries_[e].idx;
+    }
+
+private:
+    struct Entry {
+        int idx;    // 셀 인덱스
+        int next;   // 같은 버킷의 다음 항목 (또는 빈 항목 목록의 다음 항목). 없으면 -1
+    };
+
+    // 버킷 수를 늘리고 기존 목록을 다시 연결.
+    // 범위가 버킷 수보다 작으므로 버킷 i에 들어 있는 우선순위는 [min_, min_ + 버킷 수) 안의 단 하나의 값.
+    void grow(int spread) {
+        int n = heads_.size();
+        while (spread >= n) n <<= 1;
+
+        std::vector<int> old(n, -1);
+        old.swap(heads_);
+        int old_mask = mask_;
+        mask_ = n - 1;
+
+        for (int i = 0; i <= old_mask; i++) {
+            int priority = min_ + ((i - min_) & old_mask);
+            heads_[priority & mask_] = old[i];
+        }
+    }
+
+    std::vector<int> heads_;      // 버킷별 첫 항목. 비어 있으면 -1
+    std::vector<Entry> entries_;  // 모든 버킷이 공유하는 항목 저장소
+    int free_ = -1;               // 재사용할 빈 항목 목록
+    int mask_ = 0;                // 버킷 수 - 1 (버킷 수는 2의 거듭제곱)
+    int min_ = 0, max_ = 0;       // 큐 안의 우선순위 범위. max_는 pop 시 줄이지 않음 (상한값)
+    size_t count_ = 0;
+};
+
+#endif
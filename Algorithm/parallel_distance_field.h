@@ -0,0 +1,311 @@
+#ifndef PARALLEL_DISTANCE_FIELD_H
+#define PARALLEL_DISTANCE_FIELD_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+#include "grid_map.h"
+#include "grid_policy.h"
+#include "distance_field.h"
+
+// 멀티 스레드 전체 거리 지도 (delta-stepping)
+// 큰 지도 하나의 DistanceField를 모든 코어로 계산함. (BatchPlanner는 요청 여러 개를 나누고, 이쪽은 요청 하나를 나눔)
+//
+// 셀을 목표까지의 잠정 거리에 따라 폭 delta의 버킷 [b * delta, (b + 1) * delta)에 넣고, 버킷을 작은 순서대로 처리함.
+// delta는 지도에서 가장 싼 이동 비용이므로, 버킷 b의 셀에서 완화한 이웃은 항상 b보다 뒤 버킷으로 감.
+// 따라서 버킷 b를 꺼낼 때 그 안의 모든 셀의 거리는 이미 확정되어 있고, 버킷 하나를 모든 스레드가 나누어 동시에 확장함.
+// (비용 1 지도에서는 버킷 하나가 BFS 한 단계)
+// 이웃 거리는 compare-and-swap으로 최소값만 남기고, 새 셀은 스레드별 버킷 목록에 넣음. 버킷 사이에서 한 번 동기화.
+//
+// 결정성: 최단 거리는 유일하므로 거리 지도는 스레드 수, 실행 순서와 관계없이 다익스트라와 같음.
+// 다음 이동 셀은 탐색 중의 부모가 아니라 거리 확정 후 "거리 = 이웃 거리 + 이동 비용"인 첫 번째 이웃 (방향 순서)으로 정하므로
+// 역시 스레드 수와 관계없이 항상 같음. (GridPlanner::distanceField의 다음 이동 셀과는 거리가 같은 이웃 중 선택이 다를 수 있음)
+//
+// 빌드 시 -pthread 필요 (g++ -std=c++17 -O2 -pthread ...)
+template <class Neighborhood, class CostModel>
+class BasicParallelDistancePlanner {
+public:
+    // threads: 사용할 스레드 수 (호출 스레드 포함). 0이면 하드웨어 스레드 수
+    explicit BasicParallelDistancePlanner(const GridMap& map, int threads = 0) : map_(&map) {
+        if (threads <= 0) threads = std::thread::hardware_concurrency();
+        if (threads <= 0) threads = 1;
+        workers_.resize(threads);
+        for (int i = 1; i < threads; i++) {
+            threads_.emplace_back([this, i]() { workerLoop(i); });
+        }
+
+        stride_ = map.stride();
+        for (int i = 0; i < Neighborhood::kCount; i++) {
+            offsets_[i] = Neighborhood::kDirections[i][0] * stride_ + Neighborhood::kDirections[i][1];
+        }
+        bindCosts();
+    }
+
+    ~BasicParallelDistancePlanner() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_cv_.notify_all();
+        for (auto& thread : threads_) thread.join();
+    }
+
+    BasicParallelDistancePlanner(const BasicParallelDistancePlanner&) = delete;
+    BasicParallelDistancePlanner& operator=(const BasicParallelDistancePlanner&) = delete;
+
+    int threadCount() const { return workers_.size(); }
+
+    // 셀 비용(GridMap::setCost)을 바꾼 뒤 호출. 버킷 폭과 버킷 수를 다시 계산함. (장애물만 바꿨으면 필요 없음)
+    void bindCosts() {
+        int min_step = INT_MAX, max_step = 0;
+        forEachDirection<Neighborhood>([&](auto dir) {
+            constexpr int i = decltype(dir)::value;
+            min_step = std::min(min_step, stepCost<Neighborhood, i>());
+            max_step = std::max(max_step, stepCost<Neighborhood, i>());
+        });
+        int min_edge = INT_MAX, max_edge = 1;
+        for (int idx = 0; idx < map_->cellCount(); idx++) {
+            if (!map_->isFree(idx)) continue;
+            min_edge = std::min(min_edge, CostModel::cost(*map_, idx, min_step));
+            max_edge = std::max(max_edge, CostModel::cost(*map_, idx, max_step));
+        }
+        // 비용 0인 이동은 같은 버킷으로 돌아오므로 처리할 수 없음 (GridMap::view로 연결한 외부 비용 배열).
+        // 버킷 폭은 1로 두고 (0으로 나누지 않음) distanceField()가 false를 반환하게 함.
+        zero_cost_ = min_edge < 1;
+        delta_ = min_edge == INT_MAX || zero_cost_ ? 1 : min_edge;
+        ring_ = max_edge / delta_ + 2;
+        for (auto& worker : workers_) worker.buckets.assign(ring_, {});
+    }
+
+    // goal에서 도달 가능한 모든 셀의 목표까지 거리와 다음 이동 셀을 field에 저장.
+    // goal이 장애물이거나 지도에 비용 0인 셀이 있으면 false.
+    bool distanceField(Point goal, DistanceField& field) {
+        field.reset(*map_, goal);
+        visit_cnt_ = 0;
+        phase_cnt_ = 0;
+        if (!map_->isFree(goal.x, goal.y) || zero_cost_) return false;
+
+        dist_ = field.dist_.data();
+        next_ = field.next_.data();
+        done_.assign(map_->cellCount(), 0);
+        for (auto& worker : workers_) {
+            worker.visit_cnt = 0;
+            for (auto& bucket : worker.buckets) bucket.clear();
+        }
+
+        const int goal_idx = map_->index(goal.x, goal.y);
+        dist_[goal_idx] = 0;
+        workers_[0].buckets[0].push_back(goal_idx);
+
+        // 버킷을 작은 순서대로 처리
+        for (long bucket = 0; nextBucket(bucket); bucket++) {
+            frontier_.clear();
+            for (auto& worker : workers_) {
+                std::vector<int>& cells = worker.buckets[bucket % ring_];
+                frontier_.insert(frontier_.end(), cells.begin(), cells.end());
+                cells.clear();
+            }
+            phase_cnt_++;
+
+            // 작은 버킷은 동기화 비용이 더 크므로 호출 스레드에서 처리
+            if ((int)frontier_.size() < kParallelMin || workers_.size() == 1) {
+                for (int idx : frontier_) expand(workers_[0], idx, bucket);
+            } else {
+                next_chunk_.store(0);
+                run([&](int id) {
+                    Worker& worker = workers_[id];
+                    while (true) {
+                        size_t begin = next_chunk_.fetch_add(kChunk);
+                        if (begin >= frontier_.size()) return;
+                        size_t end = std::min(frontier_.size(), begin + kChunk);
+                        for (size_t i = begin; i < end; i++) expand(worker, frontier_[i], bucket);
+                    }
+                });
+            }
+        }
+
+        // 거리가 확정된 뒤 다음 이동 셀을 행 단위로 나누어 계산
+        next_chunk_.store(0);
+        run([&](int) {
+            const int rows = map_->rows();
+            while (true) {
+                int begin = next_chunk_.fetch_add(kRowChunk);
+                if (begin >= rows) return;
+                for (int x = begin; x < std::min(rows, begin + kRowChunk); x++) linkRow(x, goal_idx);
+            }
+        });
+
+        for (auto& worker : workers_) visit_cnt_ += worker.visit_cnt;
+        return true;
+    }
+
+    // 마지막 distanceField()에서 확장한 셀 수
+    int visitCount() const { return visit_cnt_; }
+
+    // 마지막 distanceField()에서 처리한 버킷 수 (스레드 동기화 횟수의 상한)
+    int phaseCount() const { return phase_cnt_; }
+
+private:
+    static constexpr int kParallelMin = 1024;   // 이보다 작은 버킷은 한 스레드에서 처리
+    static constexpr int kChunk = 256;          // 스레드가 한 번에 가져가는 셀 수
+    static constexpr int kRowChunk = 16;        // 다음 이동 셀 계산에서 한 번에 가져가는 행 수
+
+    // 스레드별 버퍼. 다른 스레드의 카운터와 같은 캐시 라인에 놓이지 않도록 정렬
+    struct alignas(64) Worker {
+        std::vector<std::vector<int>> buckets;   // 버킷 번호 % ring_ -> 이 스레드가 넣은 셀
+        int visit_cnt = 0;
+    };
+
+    int loadDist(int idx) const { return __atomic_load_n(&dist_[idx], __ATOMIC_RELAXED); }
+
+    // dist_[idx]를 value로 줄임. 다른 스레드보다 작은 값을 넣었으면 true
+    bool lowerDist(int idx, int value) {
+        int current = loadDist(idx);
+        while (value < current) {
+            if (__atomic_compare_exchange_n(&dist_[idx], &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) return true;
+        }
+        return false;
+    }
+
+    // 버킷 bucket (또는 그 뒤의 가장 가까운 비어 있지 않은 버킷)으로 이동. 모두 비었으면 false
+    bool nextBucket(long& bucket) const {
+        for (int k = 0; k < ring_; k++) {
+            for (const Worker& worker : workers_) {
+                if (!worker.buckets[(bucket + k) % ring_].empty()) {
+                    bucket += k;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // 확정된 셀 idx의 이웃 완화 (역방향: 이웃 -> idx 이동 비용은 idx에 들어가는 비용)
+    void expand(Worker& worker, int idx, long bucket) {
+        const int d = loadDist(idx);
+        if (d / delta_ != bucket) return;                            // 더 작은 거리로 다른 버킷에 다시 들어간 항목
+        if (__atomic_exchange_n(&done_[idx], 1, __ATOMIC_RELAXED)) return;   // 같은 버킷에 중복으로 들어간 항목
+        worker.visit_cnt++;
+
+        forEachMove(idx, [&](int next, int step_cost) {
+            int new_distance = d + CostModel::cost(*map_, idx, step_cost);
+            if (lowerDist(next, new_distance)) worker.buckets[(new_distance / delta_) % ring_].push_back(next);
+        });
+    }
+
+    // 행 x의 도달한 셀마다 "거리 = 이웃 거리 + 이동 비용"인 첫 번째 이웃을 다음 이동 셀로 저장
+    void linkRow(int x, int goal_idx) {
+        for (int y = 0; y < map_->cols(); y++) {
+            const int idx = map_->index(x, y);
+            const int d = dist_[idx];
+            if (d == DistanceField::kUnreachable || idx == goal_idx) continue;
+            int found = -1;
+            forEachMove(idx, [&](int next, int step_cost) {
+                if (found == -1 && dist_[next] != DistanceField::kUnreachable &&
+                    dist_[next] + CostModel::cost(*map_, next, step_cost) == d) found = next;
+            });
+            next_[idx] = found;
+        }
+    }
+
+    // GridPlanner::forEachMove와 같은 이동 규칙 (대각선은 양옆 셀이 모두 비어 있어야 함)
+    template <class F>
+    void forEachMove(int current, F&& f) const {
+        forEachDirection<Neighborhood>([&](auto dir) {
+            constexpr int i = decltype(dir)::value;
+            const int next = current + offsets_[i];
+            if (!map_->isFree(next)) return;
+            if constexpr (isDiagonal<Neighborhood, i>()) {
+                if (!map_->isFree(current + Neighborhood::kDirections[i][0] * stride_) ||
+                    !map_->isFree(current + Neighborhood::kDirections[i][1])) return;
+            }
+            f(next, stepCost<Neighborhood, i>());
+        });
+    }
+
+    // task(스레드 번호)를 모든 스레드에서 실행하고, 끝날 때까지 기다림. (BatchPlanner와 같은 방식, 호출 스레드는 0번)
+    using Task = std::function<void(int)>;
+
+    void run(const Task& task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            active_ = threads_.size();
+            epoch_++;
+        }
+        start_cv_.notify_all();
+
+        task(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return active_ == 0; });
+        task_ = nullptr;
+    }
+
+    void workerLoop(int id) {
+        uint64_t seen_epoch = 0;
+        while (true) {
+            const Task* task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_cv_.wait(lock, [&]() { return stop_ || epoch_ != seen_epoch; });
+                if (stop_) return;
+                seen_epoch = epoch_;
+                task = task_;
+            }
+
+            (*task)(id);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                active_--;
+            }
+            done_cv_.notify_one();
+        }
+    }
+
+    const GridMap* map_;
+    int stride_ = 0;
+    int offsets_[Neighborhood::kCount] = {};
+
+    int delta_ = 1;   // 버킷 폭 = 가장 싼 이동 비용
+    int ring_ = 2;    // 동시에 쓰이는 버킷 수 (가장 비싼 이동 비용 / delta + 2). 버킷 번호 % ring_으로 재사용
+    bool zero_cost_ = false;   // 비용 0인 이동이 있음 (탐색 불가)
+
+    int* dist_ = nullptr;              // 탐색 중인 field의 거리 배열 (스레드가 원자적으로 읽고 씀)
+    int* next_ = nullptr;
+    std::vector<uint8_t> done_;        // 확장한 셀
+    std::vector<int> frontier_;        // 이번에 처리하는 버킷의 셀 (모든 스레드의 목록을 합친 것)
+    std::vector<Worker> workers_;      // 0번은 호출 스레드용
+    std::atomic<size_t> next_chunk_{0};
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_, done_cv_;
+    const Task* task_ = nullptr;
+    int active_ = 0;                   // 아직 작업 중인 worker 수
+    uint64_t epoch_ = 0;               // run() 호출 번호. worker가 새 작업을 구분하는 데 사용
+    bool stop_ = false;
+
+    int visit_cnt_ = 0;
+    int phase_cnt_ = 0;
+};
+
+// 4방향, 이동 비용 1
+using ParallelDistancePlanner = BasicParallelDistancePlanner<FourConnected, UniformCost>;
+
+// 8방향 (직선 10, 대각선 14)
+using ParallelDistancePlanner8 = BasicParallelDistancePlanner<EightConnected, UniformCost>;
+
+// 셀 비용 (GridMap::setCost) 적용
+using WeightedParallelDistancePlanner = BasicParallelDistancePlanner<FourConnected, WeightedCost>;
+using WeightedParallelDistancePlanner8 = BasicParallelDistancePlanner<EightConnected, WeightedCost>;
+
+#endif
@@ -0,0 +1,280 @@
+#ifndef PATH_CACHE_H
+#define PATH_CACHE_H
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+#include "grid_map.h"
+#include "grid_path.h"
+#include "grid_policy.h"
+#include "heuristic.h"
+
+// 경로 캐시 (LRU)
+// 같은 시점/종점 요청이 반복될 때 (도크 -> 선반 경로 등) 탐색 대신 해시 조회 한 번으로 이전 결과를 돌려줌.
+// 키: (시점, 종점, options). options는 호출하는 쪽이 정하는 플래너 설정 번호 (알고리즘, 휴리스틱, 로봇 반지름 등)
+// 경로는 CompactPath (방향 체인)로 저장하므로 항목 하나가 수십 byte. 용량을 넘으면 가장 오래 쓰지 않은 항목을 버림.
+//
+// 지도가 바뀌면 invalidateCells()에 바뀐 셀 목록을 넘김. 캐시 전체를 비우지 않고 영향받는 항목만 지움.
+// - 경로가 지나가는 셀 (대각선 이동의 양옆 셀 포함)이 바뀜 (막힘, 비용 변경): 그 경로는 더 이상 유효하지 않거나 비용이 다름
+// - 열린 셀 c (막힘 -> 열림, 비용 감소)가 h(시점, c) + h(c, 종점) < 경로 비용: c를 지나는 더 짧은 경로가 생겼을 수 있음
+//   8방향은 c가 열리면 c 옆을 지나는 대각선 이동도 새로 가능해지므로 c와 주변 8셀을 모두 확인
+// 그 외의 항목은 새 지도에서도 같은 최적 경로이므로 다음 version으로 그대로 넘어감.
+// Neighborhood는 캐시에 넣는 경로를 만든 플래너와 같아야 하고, Heuristic은 그 비용 단위의 허용 가능한 휴리스틱이어야 함.
+// 경로가 없다는 결과는 저장하지 않음. (ComponentMap으로 O(1)에 거를 수 있음)
+
+// 캐시 누적 통계
+struct PathCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stores = 0;
+    uint64_t evictions = 0;     // 용량 초과로 버린 항목
+    uint64_t invalidated = 0;   // 지도 변경으로 지운 항목
+
+    double hitRate() const { return hits + misses ? (double)hits / (hits + misses) : 0.0; }
+    void clear() { *this = PathCacheStats(); }
+};
+
+template <class Neighborhood = FourConnected, class Heuristic = typename Neighborhood::DefaultHeuristic>
+class BasicPathCache {
+public:
+    // map은 캐시보다 오래 살아 있어야 함. (인덱스 계산과 invalidateCells에서 셀 상태 확인에 사용)
+    explicit BasicPathCache(const GridMap& map, size_t capacity = 1024, Heuristic heuristic = Heuristic())
+        : map_(&map), heuristic_(heuristic), entries_(capacity) {
+        index_.reserve(capacity);
+        for (size_t i = capacity; i > 0; i--) unused_.push_back(i - 1);
+    }
+
+    // 저장된 경로가 있으면 path에 복원하고 true. 조회한 항목은 가장 최근 항목이 됨
+    bool lookup(Point start, Point goal, GridPath& path, uint32_t options = 0) {
+        auto it = index_.find(makeKey(start, goal, options));
+        if (it == index_.end()) {
+            stats_.misses++;
+            return false;
+        }
+        stats_.hits++;
+        Entry& entry = entries_[it->second];
+        entry.path.decode(path);
+        last_cost_ = entry.cost;
+        moveToFront(it->second);
+        return true;
+    }
+
+    // 탐색 결과 저장. cost는 플래너의 pathCost(). 연속한 셀이 이웃하지 않는 경로는 저장하지 않고 false
+    bool store(Point start, Point goal, const GridPath& path, int cost, uint32_t options = 0) {
+        if (entries_.empty() || path.empty()) return false;
+        Key key = makeKey(start, goal, options);
+        auto it = index_.find(key);
+        int slot;
+        if (it != index_.end()) {
+            slot = it->second;
+        } else {
+            if (unused_.empty()) {
+                // 가장 오래 쓰지 않은 항목을 버림
+                stats_.evictions++;
+                remove(tail_);
+            }
+            slot = unused_.back();
+            unused_.pop_back();
+            index_.emplace(key, slot);
+            entries_[slot].key = key;
+            linkFront(slot);
+        }
+
+        Entry& entry = entries_[slot];
+        if (!entry.path.encode(path)) {
+            remove(slot);
+            return false;
+        }
+        entry.cost = cost;
+        entry.min_x = entry.min_y = INT32_MAX;
+        entry.max_x = entry.max_y = INT32_MIN;
+        for (Point p : path) {
+            entry.min_x = std::min(entry.min_x, p.x);
+            entry.max_x = std::max(entry.max_x, p.x);
+            entry.min_y = std::min(entry.min_y, p.y);
+            entry.max_y = std::max(entry.max_y, p.y);
+        }
+        moveToFront(slot);
+        stats_.stores++;
+        return true;
+    }
+
+    // 캐시를 먼저 보고, 없으면 planner.aStarAlgorithm()으로 탐색해서 저장.
+    // Planner: BasicGridPlanner 등 aStarAlgorithm(start, goal, GridPath&)와 pathCost()가 있는 플래너
+    template <class Planner>
+    bool findPath(Planner& planner, Point start, Point goal, GridPath& path, uint32_t options = 0) {
+        if (lookup(start, goal, path, options)) return true;
+        if (!planner.aStarAlgorithm(start, goal, path)) return false;
+        last_cost_ = planner.pathCost();
+        store(start, goal, path, last_cost_, options);
+        return true;
+    }
+
+    // changed 셀들이 바뀐 뒤 호출. 바뀐 셀을 지나거나, 열린 셀로 더 짧아질 수 있는 항목만 지우고 version을 올림.
+    // 항목마다 경로의 범위 (bounding box)로 먼저 거르고, 범위 안에 바뀐 셀이 있는 항목만 경로를 복원해서 확인함.
+    void invalidateCells(const std::vector<Point>& changed) {
+        version_++;
+        if (changed.empty() || index_.empty()) return;
+
+        std::vector<int> cells;
+        std::vector<Point> opened;
+        for (const Point& p : changed) {
+            if (!map_->inside(p.x, p.y)) continue;
+            cells.push_back(map_->index(p.x, p.y));
+            if (map_->isFree(p.x, p.y)) opened.push_back(p);
+        }
+        std::sort(cells.begin(), cells.end());
+
+        for (int slot = head_; slot != -1;) {
+            const int next = entries_[slot].next;
+            if (affected(entries_[slot], changed, cells, opened)) {
+                remove(slot);
+                stats_.invalidated++;
+            }
+            slot = next;
+        }
+    }
+
+    // 모든 항목 삭제 (지도 전체가 바뀌었을 때)
+    void clear() {
+        while (head_ != -1) remove(head_);
+        version_++;
+    }
+
+    // 마지막으로 돌려준 경로 (lookup 적중 또는 findPath)의 비용
+    int pathCost() const { return last_cost_; }
+
+    size_t size() const { return index_.size(); }
+    size_t capacity() const { return entries_.size(); }
+
+    // 저장된 경로의 크기 (byte, 방향 체인 + 항목 정보)
+    size_t bytes() const {
+        size_t total = 0;
+        for (int slot = head_; slot != -1; slot = entries_[slot].next) total += entries_[slot].path.bytes() + sizeof(Entry);
+        return total;
+    }
+
+    // invalidateCells / clear 호출마다 1씩 증가. 남아 있는 항목은 항상 현재 version의 지도에 대한 결과
+    uint64_t version() const { return version_; }
+
+    const PathCacheStats& stats() const { return stats_; }
+    void clearStats() { stats_.clear(); }
+
+private:
+    struct Key {
+        int start, goal;
+        uint32_t options;
+
+        bool operator==(const Key& other) const {
+            return start == other.start && goal == other.goal && options == other.options;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            uint64_t h = (uint64_t)(uint32_t)key.start * 0x9E3779B97F4A7C15ull;
+            h ^= ((uint64_t)(uint32_t)key.goal << 32 | key.options) + 0x632BE59BD9B4E019ull + (h << 6) + (h >> 2);
+            return h ^ (h >> 29);
+        }
+    };
+
+    struct Entry {
+        Key key = {0, 0, 0};
+        CompactPath path;
+        int cost = 0;
+        int min_x = 0, min_y = 0, max_x = 0, max_y = 0;   // 경로의 범위
+        int prev = -1, next = -1;                          // LRU 목록 (head_: 가장 최근)
+    };
+
+    Key makeKey(Point start, Point goal, uint32_t options) const {
+        return {map_->index(start.x, start.y), map_->index(goal.x, goal.y), options};
+    }
+
+    bool affected(const Entry& entry, const std::vector<Point>& changed, const std::vector<int>& cells,
+                  const std::vector<Point>& opened) const {
+        const Point start = map_->toPoint(entry.key.start), goal = map_->toPoint(entry.key.goal);
+        constexpr int reach = Neighborhood::kCount == 8 ? 1 : 0;
+        for (const Point& c : opened) {
+            for (int x = c.x - reach; x <= c.x + reach; x++) {
+                for (int y = c.y - reach; y <= c.y + reach; y++) {
+                    if (heuristic_(start.x, start.y, x, y) + heuristic_(x, y, goal.x, goal.y) < entry.cost) return true;
+                }
+            }
+        }
+
+        bool inside = false;
+        for (const Point& c : changed) {
+            if (c.x >= entry.min_x && c.x <= entry.max_x && c.y >= entry.min_y && c.y <= entry.max_y) {
+                inside = true;
+                break;
+            }
+        }
+        if (!inside) return false;
+
+        // 경로의 셀과, 대각선 이동이 지나가는 양옆 셀 (대각선은 양옆이 모두 비어 있어야 이동 가능)
+        entry.path.decode(scratch_);
+        auto hit = [&](int cell) { return std::binary_search(cells.begin(), cells.end(), cell); };
+        const int stride = map_->stride();
+        for (size_t i = 0; i < scratch_.size(); i++) {
+            const int cell = scratch_.cell(i);
+            if (hit(cell)) return true;
+            if (i == 0) continue;
+            const Point a = scratch_[i - 1], b = scratch_[i];
+            if (a.x != b.x && a.y != b.y && (hit(scratch_.cell(i - 1) + (b.x - a.x) * stride) || hit(cell - (b.x - a.x) * stride)))
+                return true;
+        }
+        return false;
+    }
+
+    void linkFront(int slot) {
+        Entry& entry = entries_[slot];
+        entry.prev = -1;
+        entry.next = head_;
+        if (head_ != -1) entries_[head_].prev = slot;
+        head_ = slot;
+        if (tail_ == -1) tail_ = slot;
+    }
+
+    void unlink(int slot) {
+        Entry& entry = entries_[slot];
+        if (entry.prev != -1) entries_[entry.prev].next = entry.next;
+        else head_ = entry.next;
+        if (entry.next != -1) entries_[entry.next].prev = entry.prev;
+        else tail_ = entry.prev;
+        entry.prev = entry.next = -1;
+    }
+
+    void moveToFront(int slot) {
+        if (head_ == slot) return;
+        unlink(slot);
+        linkFront(slot);
+    }
+
+    // 해시와 LRU 목록에서 지우고 슬롯을 반환
+    void remove(int slot) {
+        index_.erase(entries_[slot].key);
+        unlink(slot);
+        unused_.push_back(slot);
+    }
+
+    const GridMap* map_;
+    Heuristic heuristic_;
+    std::vector<Entry> entries_;                 // 고정 크기 슬롯 (capacity)
+    std::unordered_map<Key, int, KeyHash> index_;
+    std::vector<int> unused_;                    // 비어 있는 슬롯
+    int head_ = -1, tail_ = -1;
+
+    mutable GridPath scratch_;                   // invalidateCells에서 경로 복원용
+    int last_cost_ = 0;
+    uint64_t version_ = 0;
+    PathCacheStats stats_;
+};
+
+// 4방향 플래너 (GridPlanner, WeightedGridPlanner)와 8방향 플래너 (GridPlanner8, WeightedGridPlanner8)용
+using PathCache = BasicPathCache<FourConnected>;
+using PathCache8 = BasicPathCache<EightConnected>;
+
+#endif
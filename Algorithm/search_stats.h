@@ -0,0 +1,133 @@
+#ifndef SEARCH_STATS_H
+#define SEARCH_STATS_H
+
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+
+// 탐색 계측
+// 플래너는 탐색할 때마다 SearchStats를 채우고, PLANNER_TRACE가 켜져 있으면 확장 순서를 SearchTrace에 기록함.
+//   PLANNER_STATS (기본 1): 0으로 빌드하면 카운터/시간 측정 코드가 if constexpr로 모두 빠짐. (stats()는 0만 반환)
+//   PLANNER_TRACE (기본 0): 1로 빌드하면 확장한 셀 순서를 기록. 확장마다 vector에 추가하므로 측정용 빌드에서만 사용.
+// 예: g++ -O2 -DPLANNER_STATS=0 ... (배포용), g++ -O2 -DPLANNER_TRACE=1 ... (확장 순서 분석용)
+#ifndef PLANNER_STATS
+#define PLANNER_STATS 1
+#endif
+
+#ifndef PLANNER_TRACE
+#define PLANNER_TRACE 0
+#endif
+
+constexpr bool kPlannerStats = PLANNER_STATS;
+constexpr bool kPlannerTrace = PLANNER_TRACE;
+
+// 탐색 1회의 통계
+struct SearchStats {
+    int expanded = 0;           // 확장한 셀 수 (visitCount()와 같음)
+    int pushed = 0;             // openset push 횟수
+    int stale_pops = 0;         // 꺼냈지만 이미 확장한 셀이라 버린 항목 수 (더 작은 g로 다시 push된 셀의 이전 항목)
+    int peak_open = 0;          // openset 최대 크기 (버린 항목 포함)
+    size_t bytes_allocated = 0; // 탐색 중 늘어난 openset 저장소와 path의 capacity (byte). 버퍼가 준비된 뒤에는 0
+
+    // 단계별 시간 (마이크로초)
+    double setup_us = 0;        // 탐색 준비 (세대 번호, openset 초기화)
+    double search_us = 0;       // openset 루프
+    double path_us = 0;         // 경로 역추적
+
+    void clear() { *this = SearchStats(); }
+};
+
+// 확장 순서 기록
+// 파일은 "STRC" + 항목 수 (uint32) 뒤에 이전 셀과의 인덱스 차이를 zigzag varint로 저장함.
+// 확장 순서에서 연속한 셀은 대부분 가까우므로 셀당 1 ~ 2 byte 정도.
+class SearchTrace {
+public:
+    void clear() { order_.clear(); }
+    void record(int idx) { order_.push_back(idx); }
+
+    // 확장한 셀 인덱스 (GridMap::index), 확장 순서
+    const std::vector<int>& order() const { return order_; }
+
+    bool save(const char* file_name) const {
+        FILE* fp = std::fopen(file_name, "wb");
+        if (!fp) return false;
+
+        std::vector<uint8_t> buffer = {'S', 'T', 'R', 'C'};
+        uint32_t count = order_.size();
+        for (int i = 0; i < 4; i++) buffer.push_back((count >> (8 * i)) & 0xFF);
+
+        int prev = 0;
+        for (int idx : order_) {
+            int32_t delta = idx - prev;
+            uint32_t zigzag = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+            while (zigzag >= 0x80) {
+                buffer.push_back((zigzag & 0x7F) | 0x80);
+                zigzag >>= 7;
+            }
+            buffer.push_back(zigzag);
+            prev = idx;
+        }
+
+        bool ok = std::fwrite(buffer.data(), 1, buffer.size(), fp) == buffer.size();
+        return std::fclose(fp) == 0 && ok;
+    }
+
+    bool load(const char* file_name) {
+        order_.clear();
+        FILE* fp = std::fopen(file_name, "rb");
+        if (!fp) return false;
+
+        uint8_t header[8];
+        bool ok = std::fread(header, 1, 8, fp) == 8 && header[0] == 'S' && header[1] == 'T' &&
+                  header[2] == 'R' && header[3] == 'C';
+        uint32_t count = ok ? header[4] | header[5] << 8 | header[6] << 16 | (uint32_t)header[7] << 24 : 0;
+
+        int prev = 0;
+        for (uint32_t i = 0; ok && i < count; i++) {
+            uint32_t zigzag = 0;
+            int c, shift = 0;
+            do {
+                c = std::fgetc(fp);
+                if (c == EOF) {
+                    ok = false;
+                    break;
+                }
+                zigzag |= (uint32_t)(c & 0x7F) << shift;
+                shift += 7;
+            } while (c & 0x80);
+            int32_t delta = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+            prev += delta;
+            order_.push_back(prev);
+        }
+        std::fclose(fp);
+        if (!ok) order_.clear();
+        return ok;
+    }
+
+private:
+    std::vector<int> order_;
+};
+
+// 단계별 시간 측정. PLANNER_STATS가 0이면 아무것도 하지 않음.
+class PhaseTimer {
+public:
+    void start() {
+        if constexpr (kPlannerStats) last_ = std::chrono::steady_clock::now();
+    }
+
+    // 마지막 start()/mark() 이후 경과 시간을 us에 더함
+    void mark(double& us) {
+        if constexpr (kPlannerStats) {
+            auto now = std::chrono::steady_clock::now();
+            us += std::chrono::duration<double, std::micro>(now - last_).count();
+            last_ = now;
+        }
+    }
+
+private:
+    std::chrono::steady_clock::time_point last_;
+};
+
+#endif
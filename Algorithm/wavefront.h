@@ -0,0 +1,158 @@
+#ifndef WAVEFRONT_H
+#define WAVEFRONT_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "grid_map.h"
+#include "distance_field.h"
+
+// 비트 병렬 wavefront (4방향, 이동 비용 1 전용 전체 거리 지도)
+// 비용이 모두 1이면 다익스트라는 BFS와 같으므로, 힙 없이 거리 d인 셀 집합(frontier)을 한 번에 한 단계씩 넓힘.
+// 지도의 이동 가능 / 방문 / frontier 셀을 행마다 64셀 단위 비트셋(uint64_t)으로 저장하고,
+// 다음 frontier = (frontier를 좌우로 1 bit shift | 위아래 행의 frontier) & 이동 가능 & ~방문 을 워드 단위로 계산함.
+// frontier가 있는 워드와 그 이웃 워드만 처리하므로, 한 단계의 비용은 지도 크기가 아니라 frontier 길이에 비례함.
+//
+// 결과는 GridPlanner::distanceField()와 같은 DistanceField. 거리는 같고,
+// 다음 이동 셀은 거리가 같은 이웃이 여럿이면 동, 남, 서, 북 순서로 고름. (다익스트라와 다를 수 있지만 모두 최단 경로)
+// 지도는 bind()할 때 비트셋으로 복사하므로, 셀을 바꾼 뒤에는 다시 bind()해야 함.
+class WavefrontPlanner {
+public:
+    WavefrontPlanner() = default;
+
+    explicit WavefrontPlanner(const GridMap& map) {
+        bind(map);
+    }
+
+    void bind(const GridMap& map) {
+        map_ = &map;
+        rows_ = map.rows();
+        cols_ = map.cols();
+        // 한 행 = 워드 words_개 + 양쪽 여백 1워드. 위아래 여백 1행. (여백은 항상 0이므로 경계 검사 없음)
+        words_ = (cols_ + 63) / 64;
+        row_stride_ = words_ + 2;
+        int total = (rows_ + 2) * row_stride_;
+
+        free_.assign(total, 0);
+        visited_.assign(total, 0);
+        frontier_.assign(total, 0);
+        reach_.assign(total, 0);
+
+        for (int x = 0; x < rows_; x++) {
+            for (int y = 0; y < cols_; y++) {
+                if (map.isFree(x, y)) free_[word(x, y)] |= bit(y);
+            }
+        }
+    }
+
+    // goal에서 도달 가능한 모든 셀의 목표까지 거리와 다음 이동 셀을 field에 저장.
+    bool distanceField(Point goal, DistanceField& field) {
+        field.reset(*map_, goal);
+        visit_cnt_ = 0;
+        if (!map_->isFree(goal.x, goal.y)) return false;
+
+        std::fill(visited_.begin(), visited_.end(), 0);
+        active_.clear();
+
+        int w = word(goal.x, goal.y);
+        frontier_[w] = visited_[w] = bit(goal.y);
+        active_.push_back(w);
+        field.dist_[map_->index(goal.x, goal.y)] = 0;
+        visit_cnt_ = 1;
+
+        const int stride = map_->stride();
+        for (int d = 1; !active_.empty(); d++) {
+            // frontier를 상하좌우로 한 칸 넓힌 비트를 reach_에 모음. 처음 값이 생긴 워드를 후보로 기록
+            candidates_.clear();
+            for (int a : active_) {
+                const uint64_t f = frontier_[a];
+                spread(a, (f << 1) | (f >> 1));
+                spread(a - 1, f << 63);
+                spread(a + 1, f >> 63);
+                spread(a - row_stride_, f);
+                spread(a + row_stride_, f);
+            }
+
+            // 워드마다 방향별로 frontier와 이웃한 셀을 구하고, 새로 도달한 셀에 거리와 다음 이동 셀을 기록
+            next_active_.clear();
+            new_bits_.clear();
+            for (int c : candidates_) {
+                uint64_t reached = reach_[c] & free_[c] & ~visited_[c];
+                reach_[c] = 0;
+                if (!reached) continue;
+
+                uint64_t from_east = (frontier_[c] >> 1) | (frontier_[c + 1] << 63);   // 동쪽 이웃이 frontier
+                uint64_t from_west = (frontier_[c] << 1) | (frontier_[c - 1] >> 63);   // 서쪽 이웃이 frontier
+                uint64_t from_south = frontier_[c + row_stride_];
+
+                next_active_.push_back(c);
+                new_bits_.push_back(reached);
+                visit_cnt_ += __builtin_popcountll(reached);
+
+                // 다음 이동 방향 (동, 남, 서, 북 순서로 먼저 해당하는 방향)
+                uint64_t east = reached & from_east;
+                uint64_t south = reached & from_south & ~east;
+                uint64_t west = reached & from_west & ~east & ~south;
+                uint64_t north = reached & ~east & ~south & ~west;   // 나머지는 북쪽 이웃이 frontier
+
+                const int x = c / row_stride_ - 1, y0 = (c % row_stride_ - 1) * 64;
+                const int base = map_->index(x, y0);
+                writeCells(field, east, base, d, 1);
+                writeCells(field, south, base, d, stride);
+                writeCells(field, west, base, d, -1);
+                writeCells(field, north, base, d, -stride);
+            }
+
+            // frontier 교체
+            for (int a : active_) frontier_[a] = 0;
+            for (int i = 0; i < (int)next_active_.size(); i++) {
+                frontier_[next_active_[i]] = new_bits_[i];
+                visited_[next_active_[i]] |= new_bits_[i];
+            }
+            active_.swap(next_active_);
+        }
+        return true;
+    }
+
+    // 마지막 distanceField()에서 도달한 셀 수
+    int visitCount() const { return visit_cnt_; }
+
+private:
+    int word(int x, int y) const { return (x + 1) * row_stride_ + (y >> 6) + 1; }
+    static uint64_t bit(int y) { return uint64_t(1) << (y & 63); }
+
+    // 워드 c에 bits를 OR. 이번 단계에서 처음 값이 생긴 워드면 후보 목록에 추가
+    void spread(int c, uint64_t bits) {
+        if (!bits) return;
+        if (!reach_[c]) candidates_.push_back(c);
+        reach_[c] |= bits;
+    }
+
+    // mask의 각 bit (워드 안의 열 j) 셀에 거리 d와 다음 이동 셀 (셀 + offset) 기록
+    static void writeCells(DistanceField& field, uint64_t mask, int base, int d, int offset) {
+        while (mask) {
+            int idx = base + __builtin_ctzll(mask);
+            field.dist_[idx] = d;
+            field.next_[idx] = idx + offset;
+            mask &= mask - 1;
+        }
+    }
+
+    const GridMap* map_ = nullptr;
+    int rows_ = 0, cols_ = 0, words_ = 0, row_stride_ = 0;
+
+    // 행 우선 비트셋. 워드 (x + 1) * row_stride_ + (y / 64) + 1 의 bit (y % 64) = 셀 (x, y)
+    std::vector<uint64_t> free_;
+    std::vector<uint64_t> visited_;
+    std::vector<uint64_t> frontier_;
+
+    std::vector<uint64_t> reach_;     // frontier의 이웃 셀 (이번 단계의 후보 워드만 값이 있고, 처리 후 0으로 되돌림)
+
+    std::vector<int> active_, next_active_, candidates_;   // frontier가 있는 워드 목록
+    std::vector<uint64_t> new_bits_;
+
+    int visit_cnt_ = 0;
+};
+
+#endif
@@ -0,0 +1,172 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <ctime>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/landmark.h"
+#include "test_maps.h"
+
+using namespace std;
+
+// 미로 생성 (깊이 우선 탐색). 한 변이 2 * cells + 1, 벽 두께 1
+GridMap generateMaze(int cells, mt19937& rng) {
+    int size = 2 * cells + 1;
+    GridMap maze(size, size);
+    for (int x = 0; x < size; x++) {
+        for (int y = 0; y < size; y++) maze.setBlocked(x, y, x % 2 == 0 || y % 2 == 0);
+    }
+    vector<bool> visited(cells * cells, false);
+    vector<int> stack = {0};
+    visited[0] = true;
+    const int dirs[4][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}};
+    while (!stack.empty()) {
+        int c = stack.back(), cx = c / cells, cy = c % cells;
+        vector<int> next;
+        for (auto& d : dirs) {
+            int nx = cx + d[0], ny = cy + d[1];
+            if (nx >= 0 && nx < cells && ny >= 0 && ny < cells && !visited[nx * cells + ny]) next.push_back(nx * cells + ny);
+        }
+        if (next.empty()) {
+            stack.pop_back();
+            continue;
+        }
+        int n = next[rng() % next.size()], nx = n / cells, ny = n % cells;
+        maze.setBlocked(cx + nx + 1, cy + ny + 1, false);   // 두 칸 사이의 벽
+        visited[n] = true;
+        stack.push_back(n);
+    }
+    return maze;
+}
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    // 결과 경로 출력용 벡터 (O: 미방문 노드, X: 방문한 노드, . : 경로)
+    vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+
+    GridMap map = GridMap::fromMaze(maze);
+    GridPlanner planner(map);
+    vector<Point> path;
+
+    // 전처리: 랜드마크 4개의 거리 표를 만들어 파일로 저장 (지도가 바뀌지 않는 동안 한 번만)
+    const char* file_name = "test_map.alt";
+    LandmarkTable built;
+    built.build(planner, 4);
+    built.save(file_name);
+
+    // 실행 시: 파일에서 읽어서 사용 (표를 만든 지도와 같은 지도여야 함)
+    LandmarkTable landmarks;
+    if (!landmarks.load(file_name, map)) {
+        cout << "Cannot load " << file_name << endl;
+        return 0;
+    }
+    cout << "TEST: Landmarks " << landmarks.count() << " (";
+    for (Point p : landmarks.landmarks()) cout << " (" << p.x << ", " << p.y << ")";
+    cout << " ), " << landmarks.bytes() << " bytes" << endl;
+
+    // 크기가 같아도 셀 하나가 다른 지도에는 읽지 않음 (거리 표가 맞지 않으므로 휴리스틱이 허용 가능하지 않을 수 있음)
+    GridMap edited = GridMap::fromMaze(maze);
+    edited.setBlocked(tc.start.x, tc.start.y + 1, edited.isFree(tc.start.x, tc.start.y + 1));   // 셀 하나를 뒤집음
+    LandmarkTable stale;
+    cout << "TEST: Table on Edited Map " << (stale.load(file_name, edited) ? "loaded" : "rejected") << endl;
+    remove(file_name);
+
+    planner.aStarAlgorithm(tc.start, tc.goal, path, ManhattanHeuristic());
+    cout << "TEST: Astar(Manhattan) Path Cost:" << path.size() << ", Visited Node:" << planner.visitCount() << endl;
+
+    if (planner.aStarAlgorithm(tc.start, tc.goal, path, AltHeuristic(landmarks, map, ManhattanHeuristic()))) {
+        cout << "TEST: Astar(ALT + Manhattan) Path Cost:" << path.size() << ", Visited Node:" << planner.visitCount() << endl;
+
+        for (int i = 0; i < (int)maze.size(); i++) {
+            for (int j = 0; j < (int)maze[0].size(); j++) {
+                if (planner.isVisited(i, j)) res_map[i][j] = 'X';
+            }
+        }
+        for (auto p : path) {
+            res_map[p.x][p.y] = '.';
+        }
+        for (auto row : res_map) {
+            for (char c : row) {
+                cout << c << " ";
+            }
+            cout << endl;
+        }
+    } else {
+        cout << "No path found." << endl;
+    }
+
+    // 큰 미로: 무작위 시점/종점 쌍의 평균 확장 수
+    mt19937 rng(1);
+    GridMap large = generateMaze(200, rng);
+    GridPlanner large_planner(large);
+    LandmarkTable large_landmarks;
+    large_landmarks.build(large_planner, 8);
+
+    // 다른 크기의 지도로 만든 표는 사용하지 않음 (Manhattan만 사용)
+    planner.aStarAlgorithm(tc.start, tc.goal, path, AltHeuristic(large_landmarks, map, ManhattanHeuristic()));
+    cout << "TEST: Maze Table on Test Map, Matches:" << large_landmarks.matches(map) << ", Path Cost:" << path.size()
+         << ", Visited Node:" << planner.visitCount() << endl;
+
+    const int queries = 200;
+    long long manhattan_expanded = 0, alt_expanded = 0;
+    int mismatch = 0;
+    for (int i = 0; i < queries; i++) {
+        Point s = {2 * (int)(rng() % 200) + 1, 2 * (int)(rng() % 200) + 1};
+        Point g = {2 * (int)(rng() % 200) + 1, 2 * (int)(rng() % 200) + 1};
+        large_planner.aStarAlgorithm(s, g, path, ManhattanHeuristic());
+        int cost = large_planner.pathCost();
+        manhattan_expanded += large_planner.visitCount();
+        large_planner.aStarAlgorithm(s, g, path, AltHeuristic(large_landmarks, large, ManhattanHeuristic()));
+        alt_expanded += large_planner.visitCount();
+        mismatch += cost != large_planner.pathCost();
+    }
+    cout << "TEST: Maze " << large.rows() << " x " << large.cols() << ", " << queries << " queries, mean expanded Manhattan:"
+         << manhattan_expanded / queries << ", ALT(8):" << alt_expanded / queries << ", Cost Mismatch:" << mismatch << endl;
+
+    // 셀 비용 (1 ~ 9)이 있는 지도 (장애물 20%): 들어가는 셀의 비용을 받으므로 두 방향의 거리가 다름.
+    // 양방향 A*의 역방향은 "시점 -> 셀" 하한이 필요함 (다익스트라와 비용이 같아야 함)
+    const int weighted_size = 256;
+    GridMap weighted = randomObstacleMap(weighted_size, 0.2, 5);
+    for (int x = 0; x < weighted_size; x++) {
+        for (int y = 0; y < weighted_size; y++) weighted.setCost(x, y, 1 + rng() % 9);
+    }
+    vector<pair<Point, Point>> weighted_queries;
+    for (int i = 0; i < queries; i++) {
+        Point s = {(int)(rng() % weighted_size), (int)(rng() % weighted_size)};
+        Point g = {(int)(rng() % weighted_size), (int)(rng() % weighted_size)};
+        weighted.setBlocked(s.x, s.y, false);
+        weighted.setBlocked(g.x, g.y, false);
+        weighted_queries.push_back({s, g});
+    }
+    WeightedGridPlanner weighted_planner(weighted);
+    LandmarkTable weighted_landmarks;
+    weighted_landmarks.build(weighted_planner, 8);
+
+    long long dijkstra_expanded = 0, bidirectional_expanded = 0;
+    mismatch = 0;
+    for (auto& [s, g] : weighted_queries) {
+        weighted_planner.dijkstra(s, g, path);
+        int cost = weighted_planner.pathCost();
+        dijkstra_expanded += weighted_planner.visitCount();
+        weighted_planner.bidirectionalAStar(s, g, path, AltHeuristic(weighted_landmarks, weighted, ManhattanHeuristic()));
+        bidirectional_expanded += weighted_planner.visitCount();
+        mismatch += cost != weighted_planner.pathCost();
+    }
+    cout << "TEST: Weighted " << weighted_size << " x " << weighted_size << ", " << queries << " queries, mean expanded Dijkstra:" << dijkstra_expanded / queries
+         << ", Bidirectional ALT(8):" << bidirectional_expanded / queries << ", Cost Mismatch:" << mismatch << endl;
+
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <ctime>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/anytime_planner.h"
+#include "test_maps.h"
+
+using namespace std;
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    // 결과 경로 출력용 벡터 (O: 미방문 노드, X: 방문한 노드, . : 경로)
+    vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+
+    GridMap map = GridMap::fromMaze(maze);
+    GridPlanner planner(map);
+    AnytimePlanner anytime(map);
+    vector<Point> path;
+
+    planner.aStarAlgorithm(tc.start, tc.goal, path);
+    cout << "TEST: Astar Path Cost:" << path.size() << ", Visited Node:" << planner.visitCount() << endl;
+
+    // 가중 A*: 경로 비용 <= w * 최적
+    if (anytime.weightedAStar(tc.start, tc.goal, path, 2.0)) {
+        cout << "TEST: Weighted Astar(w = 2) Path Cost:" << path.size() << ", Bound:" << anytime.bound()
+             << ", Visited Node:" << anytime.visitCount() << endl;
+
+        for (auto p : path) {
+            res_map[p.x][p.y] = '.';
+        }
+        for (auto row : res_map) {
+            for (char c : row) {
+                cout << c << " ";
+            }
+            cout << endl;
+        }
+    } else {
+        cout << "No path found." << endl;
+    }
+
+    // ARA*: 제한 없이 w = 3 -> 1까지 개선하면 최적 경로
+    if (anytime.anytimeAStar(tc.start, tc.goal, path, SearchBudget())) {
+        cout << "TEST: ARA* Path Cost:" << path.size() << ", Bound:" << anytime.bound() << ", Iteration:" << anytime.iterationCount()
+             << ", Visited Node:" << anytime.visitCount() << endl;
+    }
+
+    // 큰 지도: 10ms 제한 안에서 찾은 경로와 상한
+    const int size = 2048;
+    GridMap large(size, size);
+    mt19937 rng(1);
+    for (int i = 0; i < size * size / 4; i++) large.setBlocked(rng() % size, rng() % size, true);
+    Point s = {0, 0}, g = {size - 1, size - 1};
+    large.setBlocked(s.x, s.y, false);
+    large.setBlocked(g.x, g.y, false);
+
+    AnytimePlanner large_anytime(large);
+    auto t0 = chrono::steady_clock::now();
+    bool found = large_anytime.anytimeAStar(s, g, path, SearchBudget::within(chrono::milliseconds(10)));
+    auto t1 = chrono::steady_clock::now();
+    cout << "TEST: ARA* " << size << " x " << size << " (10ms budget) " << (found ? "Path Cost:" : "No path, ")
+         << (found ? large_anytime.pathCost() : 0) << ", Bound:" << large_anytime.bound() << ", Iteration:"
+         << large_anytime.iterationCount() << ", Budget Exhausted:" << large_anytime.budgetExhausted() << ", "
+         << chrono::duration<double, milli>(t1 - t0).count() << "ms" << endl;
+
+    GridPlanner large_planner(large);
+    t0 = chrono::steady_clock::now();
+    large_planner.aStarAlgorithm(s, g, path);
+    t1 = chrono::steady_clock::now();
+    cout << "TEST: Astar " << size << " x " << size << " Path Cost:" << large_planner.pathCost() << ", "
+         << chrono::duration<double, milli>(t1 - t0).count() << "ms" << endl;
+
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
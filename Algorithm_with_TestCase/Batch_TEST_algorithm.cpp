@@ -0,0 +1,77 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <thread>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/batch_planner.h"
+#include "test_maps.h"
+
+using namespace std;
+
+// 빌드: g++ -std=c++17 -O2 -pthread Batch_TEST_algorithm.cpp
+
+// 지도의 이동 가능한 셀에서 무작위 시점/종점 쌍 생성
+vector<PlanQuery> randomQueries(const GridMap& map, int count, mt19937& rng) {
+    vector<PlanQuery> queries;
+    uniform_int_distribution<int> rx(0, map.rows() - 1), ry(0, map.cols() - 1);
+    while ((int)queries.size() < count) {
+        Point s = {rx(rng), ry(rng)}, g = {rx(rng), ry(rng)};
+        if (map.isFree(s.x, s.y) && map.isFree(g.x, g.y)) queries.push_back({s, g});
+    }
+    return queries;
+}
+
+int main() {
+    mt19937 rng(1);
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    GridMap map = GridMap::fromMaze(tc.maze);
+
+    // 1. 결과 확인: 배치 탐색 결과가 GridPlanner로 하나씩 탐색한 결과와 같은 비용인지 비교
+    vector<PlanQuery> queries = randomQueries(map, 200, rng);
+    queries.push_back({tc.start, tc.goal});
+
+    BatchPlanner batch(map, 4);
+    vector<PlanResult> results;
+    batch.planBatch(queries, results);
+
+    GridPlanner planner(map);
+    vector<Point> path;
+    int found = 0, mismatch = 0;
+    for (size_t i = 0; i < queries.size(); i++) {
+        bool ok = planner.aStarAlgorithm(queries[i].start, queries[i].goal, path);
+        if (ok != results[i].found || path.size() != results[i].path.size()) mismatch++;
+        found += results[i].found;
+    }
+    cout << "TEST: Batch Astar (" << batch.threadCount() << " threads)" << endl;
+    cout << "Queries:" << queries.size() << ", Path found:" << found << ", Mismatch with GridPlanner:" << mismatch << endl;
+    cout << "README start/goal Path Cost:" << results.back().path.size() << endl;
+
+    // 2. 스레드 수에 따른 처리량: 512 x 512, 장애물 20% 지도
+    GridMap big(512, 512);
+    bernoulli_distribution blocked(0.2);
+    for (int x = 0; x < big.rows(); x++) {
+        for (int y = 0; y < big.cols(); y++) {
+            if (blocked(rng)) big.setBlocked(x, y, true);
+        }
+    }
+    vector<PlanQuery> big_queries = randomQueries(big, 256, rng);
+
+    int max_threads = max(1u, thread::hardware_concurrency());
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        BatchPlanner big_batch(big, threads);
+        big_batch.planBatch(big_queries, results);   // 버퍼 준비용
+
+        auto t0 = chrono::steady_clock::now();
+        big_batch.planBatch(big_queries, results);
+        auto t1 = chrono::steady_clock::now();
+        double ms = chrono::duration<double, milli>(t1 - t0).count();
+        cout << "Threads:" << threads << ", Time:" << ms << "ms, Queries/s:" << big_queries.size() / (ms / 1000.0) << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <chrono>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/clearance_map.h"
+#include "test_maps.h"
+
+using namespace std;
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    GridMap map = GridMap::fromMaze(maze);
+    ClearanceMap clearance(map);
+
+    // 셀마다 가장 가까운 장애물까지 거리 제곱 (9 이상은 +)
+    cout << "TEST: Squared Clearance" << endl;
+    for(int i=0; i<(int)maze.size(); i++){
+        for(int j=0; j<(int)maze[0].size(); j++){
+            int d = clearance.squaredClearance(i, j);
+            if(d > 9) cout << "+ ";
+            else cout << d << " ";
+        }
+        cout << endl;
+    }
+
+    // 벽에 폭 1, 폭 3인 통로가 있는 방. 반지름 0 (점) 로봇은 가까운 폭 1 통로, 반지름 1 로봇은 폭 3 통로로 지나가야 함
+    const int room_size = 20;
+    GridMap room(room_size, room_size);
+    for(int i=0; i<room_size; i++){
+        if(i != 3 && (i < 14 || i > 16)) room.setBlocked(i, 10, true);
+    }
+    Point start = {2, 2}, goal = {2, 17};
+    ClearanceMap room_clearance(room);
+
+    for(double radius : {0.0, 1.0}){
+        GridMap inflated;
+        room_clearance.inflate(radius, inflated);
+        GridPlanner planner(inflated);
+
+        // 결과 경로 출력용 벡터 (O: 미방문 노드, X: 방문한 노드, . : 경로, # : 로봇이 들어갈 수 없는 셀)
+        vector<vector<char>> res_map(room_size, vector<char>(room_size, 'O'));
+        vector<Point> path;
+        if(planner.aStarAlgorithm(start, goal, path)){
+            cout << "TEST: Astar with Radius " << radius << endl;
+            cout << "Number of Visited Node : " << planner.visitCount() << endl;
+            cout << "Path Cost : " << path.size() << endl;
+
+            for(int i=0; i<room_size; i++){
+                for(int j=0; j<room_size; j++){
+                    if(!room_clearance.isClear(i, j, radius)) res_map[i][j] = '#';
+                    else if(planner.isVisited(i, j)) res_map[i][j] = 'X';
+                }
+            }
+            for(auto p : path){
+                res_map[p.x][p.y] = '.';
+            }
+            for(auto row : res_map){
+                for(char c : row){
+                    cout << c << " ";
+                }
+                cout << endl;
+            }
+        }
+        else{
+            cout << "Path Not Found (Radius " << radius << ")" << endl;
+        }
+
+        // 경로의 모든 셀은 반지름 안에 장애물이 없어야 함
+        int violation = 0;
+        for(auto p : path){
+            violation += room_clearance.isClear(p.x, p.y, radius) ? 0 : 1;
+        }
+        cout << "TEST: Path Cells Inside Clearance Radius : " << violation << endl;
+    }
+
+    // 큰 지도 (장애물 20%)의 거리 변환 시간
+    const int size = 2048;
+    GridMap large = randomObstacleMap(size, 0.2, 7);
+    ClearanceMap large_clearance;
+    auto t0 = chrono::steady_clock::now();
+    large_clearance.update(large);
+    auto t1 = chrono::steady_clock::now();
+    cout << "TEST: " << size << " x " << size << " Clearance Map : " << chrono::duration<double, milli>(t1 - t0).count() << "ms" << endl;
+
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
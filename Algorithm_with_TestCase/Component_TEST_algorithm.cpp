@@ -0,0 +1,100 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <chrono>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/component_map.h"
+#include "test_maps.h"
+
+using namespace std;
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    GridMap map = GridMap::fromMaze(maze);
+    ComponentMap components(map);
+    GridPlanner planner(map);
+
+    // 영역 번호 출력 (장애물은 #, 번호는 A부터)
+    cout << "TEST: Connected Components : " << components.componentCount() << endl;
+    for(int i=0; i<(int)maze.size(); i++){
+        for(int j=0; j<(int)maze[0].size(); j++){
+            uint32_t label = components.label(i, j);
+            if(label == ComponentMap::kNone) cout << "# ";
+            else cout << (char)('A' + (label - 1) % 26) << " ";
+        }
+        cout << endl;
+    }
+    cout << "Start-Goal Connected : " << components.connected(tc.start, tc.goal) << endl;
+
+    // 종점의 상하좌우를 막아서 종점만 따로 떨어진 영역으로 만들고, 바뀐 셀만 갱신
+    vector<Point> changed;
+    const int dirs[4][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}};
+    for(auto& d : dirs){
+        Point p = {tc.goal.x + d[0], tc.goal.y + d[1]};
+        if(map.isFree(p.x, p.y)){
+            map.setBlocked(p.x, p.y, true);
+            changed.push_back(p);
+        }
+    }
+    components.updateCells(changed);
+    cout << "TEST: Goal Walled In, Connected Components : " << components.componentCount()
+         << ", Start-Goal Connected : " << components.connected(tc.start, tc.goal) << endl;
+
+    // 레이블 없이: 도달 가능한 영역 전체를 탐색한 뒤 실패
+    vector<Point> path;
+    bool found = planner.aStarAlgorithm(tc.start, tc.goal, path);
+    cout << "TEST: Astar without Components, Found : " << found << ", Number of Visited Node : " << planner.visitCount() << endl;
+
+    // 레이블 사용: 탐색 전에 바로 실패
+    planner.setComponents(&components);
+    found = planner.aStarAlgorithm(tc.start, tc.goal, path);
+    cout << "TEST: Astar with Components, Found : " << found << ", Number of Visited Node : " << planner.visitCount() << endl;
+
+    // 벽을 다시 열면 영역이 합쳐지고 경로를 찾음
+    for(auto p : changed){
+        map.setBlocked(p.x, p.y, false);
+    }
+    components.updateCells(changed);
+    found = planner.aStarAlgorithm(tc.start, tc.goal, path);
+    cout << "TEST: Wall Removed, Connected Components : " << components.componentCount() << ", Found : " << found
+         << ", Path Cost : " << path.size() << endl;
+
+    // 큰 지도 (장애물 30%): 막힌 종점에 대한 요청 시간
+    const int size = 2048;
+    GridMap large = randomObstacleMap(size, 0.3, 11);
+    Point start = {0, 0}, goal = {size - 2, size - 2};
+    large.setBlocked(start.x, start.y, false);
+    large.setBlocked(goal.x, goal.y, false);
+    large.setBlocked(goal.x - 1, goal.y, true);
+    large.setBlocked(goal.x + 1, goal.y, true);
+    large.setBlocked(goal.x, goal.y - 1, true);
+    large.setBlocked(goal.x, goal.y + 1, true);
+
+    auto t0 = chrono::steady_clock::now();
+    ComponentMap large_components(large);
+    auto t1 = chrono::steady_clock::now();
+    GridPlanner large_planner(large);
+    large_planner.aStarAlgorithm(start, goal, path);
+    auto t2 = chrono::steady_clock::now();
+    large_planner.setComponents(&large_components);
+    large_planner.aStarAlgorithm(start, goal, path);
+    auto t3 = chrono::steady_clock::now();
+    cout << "TEST: " << size << " x " << size << " Unreachable Goal, Labeling : " << chrono::duration<double, milli>(t1 - t0).count()
+         << "ms, Astar : " << chrono::duration<double, milli>(t2 - t1).count()
+         << "ms, Astar with Components : " << chrono::duration<double, micro>(t3 - t2).count() << "us" << endl;
+
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
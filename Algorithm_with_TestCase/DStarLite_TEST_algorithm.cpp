@@ -0,0 +1,83 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/dstar_lite.h"
+#include "test_maps.h"
+
+using namespace std;
+
+// 결과 지도 출력 (O: 이동 가능, #: 새로 막힌 셀, . : 경로)
+void printResult(const GridMap& map, const vector<vector<int>>& maze, const vector<Point>& path) {
+    vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+
+    for(int i=0; i<(int)maze.size(); i++){
+        for(int j=0; j<(int)maze[0].size(); j++){
+            if(maze[i][j] == 0 && !map.isFree(i, j)) res_map[i][j] = '#';
+        }
+    }
+
+    for (auto n : path) {
+        res_map[n.x][n.y] = '.';
+    }
+
+    for(auto row : res_map){
+        for(char n : row){
+            cout << n << " ";
+        }
+        cout << endl;
+    }
+}
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+
+    // 시간 측정 시작
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    GridMap map = GridMap::fromMaze(maze);
+    vector<Point> path, check;
+
+    // 처음 탐색: 처음부터 끝까지 확장
+    DStarLitePlanner dstar(map);
+    if (!dstar.plan(tc.start, tc.goal, path)) {
+        cout << "No path found." << endl;
+        return 0;
+    }
+    cout << "TEST: D* Lite Path found!" << endl;
+    cout << "Path Cost:" << path.size() << endl;
+    cout << "Visited Node:" << dstar.visitCount() << endl;
+
+    // 로봇이 경로를 따라 몇 칸 이동한 뒤, 센서가 앞쪽 경로 위에서 새 장애물을 발견한 상황
+    Point robot = path[5];
+    vector<Point> changed = {path[path.size() / 2]};
+    for (const Point& p : changed) map.setBlocked(p.x, p.y, true);
+
+    // 바뀐 셀 주변만 고쳐서 재탐색
+    if (dstar.replan(robot, changed, path)) {
+        cout << "TEST: D* Lite Replan Path Cost:" << path.size() << ", Visited Node:" << dstar.visitCount() << endl;
+        printResult(map, maze, path);
+    } else {
+        cout << "No path found after map change." << endl;
+    }
+
+    // 비교용: 같은 지도에서 처음부터 다시 탐색 (비용이 같아야 함)
+    GridPlanner astar(map);
+    if (astar.aStarAlgorithm(robot, tc.goal, check, ManhattanHeuristic())) {
+        cout << "TEST: Astar(from scratch) Path Cost:" << check.size() << ", Visited Node:" << astar.visitCount() << endl;
+    }
+
+    // 시간 측정 종료
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
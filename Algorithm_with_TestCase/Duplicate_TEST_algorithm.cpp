@@ -0,0 +1,92 @@
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <ctime>
+
+#include "../Algorithm/grid_planner.h"
+#include "test_maps.h"
+
+using namespace std;
+
+// 중복 처리 없는 A* (Algorithm/Astar_algorithm.cpp의 이전 방식)
+// 꺼낸 셀을 closed로 표시만 하고, 이미 closed인 셀을 다시 꺼내도 건너뛰지 않으며,
+// 이웃을 push할 때 기존의 최소 g와 비교하지 않음. -> 같은 셀이 여러 번 확장되고 openset이 커짐.
+struct NaiveResult {
+    bool found = false;
+    int cost = 0, expanded = 0, pushed = 0, peak_open = 0;
+};
+
+NaiveResult naiveAStar(const vector<vector<int>>& maze, Point start, Point goal) {
+    NaiveResult result;
+    int rows = maze.size(), cols = maze[0].size();
+    vector<vector<bool>> closed(rows, vector<bool>(cols, false));
+
+    // {f, {g, {x, y}}}
+    using Entry = pair<int, pair<int, pair<int, int>>>;
+    priority_queue<Entry, vector<Entry>, greater<Entry>> open;
+    ManhattanHeuristic heuristic;
+    open.push({heuristic(start.x, start.y, goal.x, goal.y), {0, {start.x, start.y}}});
+    result.pushed = result.peak_open = 1;
+
+    int directions[4][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}};
+    while (!open.empty()) {
+        Entry current = open.top();
+        open.pop();
+        int g = current.second.first, x = current.second.second.first, y = current.second.second.second;
+        result.expanded++;
+
+        if (x == goal.x && y == goal.y) {
+            result.found = true;
+            result.cost = g + 1;    // 경로 셀 수 (path.size())와 같은 단위
+            return result;
+        }
+        closed[x][y] = true;
+
+        for (auto& dir : directions) {
+            int nx = x + dir[0], ny = y + dir[1];
+            if (nx >= 0 && nx < rows && ny >= 0 && ny < cols && maze[nx][ny] == 0 && !closed[nx][ny]) {
+                open.push({g + 1 + heuristic(nx, ny, goal.x, goal.y), {g + 1, {nx, ny}}});
+                result.pushed++;
+                result.peak_open = max(result.peak_open, (int)open.size());
+            }
+        }
+    }
+    return result;
+}
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+
+    // 시간 측정 시작
+    start_time = clock();
+
+    // README의 두 테스트 지도 모두 비교
+    vector<TestCase> cases = {testCase1(), testCase2()};
+    for (int i = 0; i < (int)cases.size(); i++) {
+        TestCase& tc = cases[i];
+        GridMap map = GridMap::fromMaze(tc.maze);
+        GridPlanner planner(map);
+        vector<Point> path;
+
+        NaiveResult naive = naiveAStar(tc.maze, tc.start, tc.goal);
+        bool found = planner.aStarAlgorithm(tc.start, tc.goal, path, ManhattanHeuristic());
+        const SearchStats& stats = planner.stats();
+
+        cout << "TEST CASE " << i + 1 << endl;
+        cout << "TEST: Astar(no duplicate check) Path Cost:" << naive.cost << ", Expanded:" << naive.expanded
+             << ", Pushed:" << naive.pushed << ", Peak Open:" << naive.peak_open << endl;
+        cout << "TEST: Astar(closed check + best g) Path Cost:" << (found ? (int)path.size() : 0) << ", Expanded:" << stats.expanded
+             << ", Pushed:" << stats.pushed << ", Stale Pop:" << stats.stale_pops << ", Peak Open:" << stats.peak_open << endl;
+        cout << "TEST: " << (found == naive.found && (int)path.size() == naive.cost ? "same path cost" : "path cost mismatch")
+             << ", expanded " << naive.expanded << " -> " << stats.expanded
+             << ", peak open " << naive.peak_open << " -> " << stats.peak_open << endl;
+    }
+
+    // 시간 측정 종료
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
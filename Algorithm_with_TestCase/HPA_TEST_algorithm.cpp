@@ -0,0 +1,76 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/hpa_planner.h"
+#include "test_maps.h"
+
+using namespace std;
+
+// 결과 지도 출력 (O: 경로 밖 셀, . : 경로)
+void printResult(const vector<vector<int>>& maze, const vector<Point>& path) {
+    vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+
+    for (auto n : path) {
+        res_map[n.x][n.y] = '.';
+    }
+
+    for(auto row : res_map){
+        for(char n : row){
+            cout << n << " ";
+        }
+        cout << endl;
+    }
+}
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+
+    // 시간 측정 시작
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    GridMap map = GridMap::fromMaze(maze);
+    vector<Point> path;
+
+    // 비교용 A* (4방향, 맨해튼 거리)
+    GridPlanner astar(map);
+    if (astar.aStarAlgorithm(tc.start, tc.goal, path, ManhattanHeuristic())) {
+        cout << "TEST: Astar Path Cost:" << path.size() << ", Visited Node:" << astar.visitCount() << endl;
+    }
+
+    // HPA*: 5 x 5 클러스터. 경로는 최단 경로보다 조금 길 수 있음
+    HpaPlanner hpa(map, 5);
+    cout << "TEST: HPA* Cluster Size:" << hpa.clusterSize() << ", Abstract Node:" << hpa.nodeCount() << endl;
+    if (hpa.findPath(tc.start, tc.goal, path)) {
+        cout << "TEST: HPA* Path found!" << endl;
+        cout << "Path Cost:" << path.size() << endl;
+        cout << "Visited Node:" << hpa.visitCount() << " (abstract " << hpa.abstractVisitCount() << ")" << endl;
+        printResult(maze, path);
+    } else {
+        cout << "No path found." << endl;
+    }
+
+    // 경로 위의 셀 하나를 막고, 해당 클러스터만 다시 계산한 뒤 재탐색
+    Point blocked = path[path.size() / 2];
+    map.setBlocked(blocked.x, blocked.y, true);
+    hpa.updateCells({blocked});
+    if (hpa.findPath(tc.start, tc.goal, path)) {
+        cout << "TEST: HPA* after update Path Cost:" << path.size() << ", Visited Node:" << hpa.visitCount() << endl;
+    } else {
+        cout << "No path found after update." << endl;
+    }
+
+    // 시간 측정 종료
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
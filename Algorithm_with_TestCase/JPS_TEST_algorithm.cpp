@@ -0,0 +1,83 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/jps_planner.h"
+#include "test_maps.h"
+
+using namespace std;
+
+// 결과 지도 출력 (O: 미방문 노드, X: 확장한 jump point, . : 경로)
+template <class Planner>
+void printResult(Planner& planner, const vector<vector<int>>& maze, const vector<Point>& path) {
+    vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+
+    for(int i=0; i<(int)maze.size(); i++){
+        for(int j=0; j<(int)maze[0].size(); j++){
+            if(planner.isVisited(i, j)) res_map[i][j] = 'X';
+        }
+    }
+
+    for (auto n : path) {
+        res_map[n.x][n.y] = '.';
+    }
+
+    for(auto row : res_map){
+        for(char n : row){
+            cout << n << " ";
+        }
+        cout << endl;
+    }
+}
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+
+    // 시간 측정 시작
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    GridMap map = GridMap::fromMaze(maze);
+    vector<Point> path;
+
+    // 비교용 A* (4방향, 맨해튼 거리)
+    GridPlanner astar(map);
+    if (astar.aStarAlgorithm(tc.start, tc.goal, path, ManhattanHeuristic())) {
+        cout << "TEST: Astar Path Cost:" << path.size() << ", Visited Node:" << astar.visitCount() << endl;
+    }
+
+    // JPS 4방향: A*와 같은 비용이어야 함
+    JpsPlanner4 jps4(map);
+    if (jps4.jumpPointSearch(tc.start, tc.goal, path, ManhattanHeuristic())) {
+        cout << "TEST: JPS(4-connected) Path found!" << endl;
+        cout << "Path Cost:" << path.size() << endl;
+        cout << "Visited Node:" << jps4.visitCount() << endl;
+        printResult(jps4, maze, path);
+    } else {
+        cout << "No path found." << endl;
+    }
+
+    // JPS 8방향: 비용은 직선 10, 대각선 14 단위
+    JpsPlanner8 jps8(map);
+    if (jps8.jumpPointSearch(tc.start, tc.goal, path, OctileHeuristic())) {
+        cout << "TEST: JPS(8-connected) Path found!" << endl;
+        cout << "Path Cost:" << jps8.pathCost() << " (straight 10, diagonal 14), Path Node:" << path.size() << endl;
+        cout << "Visited Node:" << jps8.visitCount() << endl;
+        printResult(jps8, maze, path);
+    } else {
+        cout << "No path found." << endl;
+    }
+
+    // 시간 측정 종료
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
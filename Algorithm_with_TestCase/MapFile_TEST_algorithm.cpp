@@ -0,0 +1,88 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <chrono>
+#include <cstdio>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/map_file.h"
+#include "test_maps.h"
+
+using namespace std;
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+
+    // 시간 측정 시작
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+
+    // 이진 지도 파일로 저장한 뒤 mmap으로 다시 열기
+    const char* file_name = "test_map.gmap";
+    GridMap original = GridMap::fromMaze(tc.maze);
+    if (!saveMapFile(file_name, original)) {
+        cout << "Cannot write " << file_name << endl;
+        return 0;
+    }
+
+    GridMap map;
+    if (!loadMapFile(file_name, map)) {
+        cout << "Cannot load " << file_name << endl;
+        return 0;
+    }
+
+    int diff = 0;
+    for (int x = 0; x < map.rows(); x++) {
+        for (int y = 0; y < map.cols(); y++) diff += map.isFree(x, y) != original.isFree(x, y);
+    }
+    cout << "TEST: Map File " << map.rows() << " x " << map.cols() << ", Different Cell:" << diff << endl;
+
+    // 매핑된 지도를 그대로 사용하는 플래너 (원본 지도와 같은 결과여야 함)
+    vector<Point> path;
+    GridPlanner planner(map);
+    if (planner.aStarAlgorithm(tc.start, tc.goal, path)) {
+        cout << "TEST: Astar(mapped) Path Cost:" << path.size() << ", Visited Node:" << planner.visitCount() << endl;
+    } else {
+        cout << "No path found." << endl;
+    }
+
+    // 비용 0이 들어 있는 파일은 읽지 않음: 셀 비용이 있는 지도를 저장한 뒤 비용 byte 하나를 0으로 바꿈
+    GridMap weighted = GridMap::fromMaze(tc.maze);
+    weighted.setCost(tc.goal.x, tc.goal.y, 5);
+    saveMapFile(file_name, weighted);
+    if (FILE* fp = fopen(file_name, "r+b")) {
+        // 헤더, 셀 배열 다음이 비용 배열
+        fseek(fp, sizeof(MapFileHeader) + weighted.cellCount() + weighted.index(tc.goal.x, tc.goal.y), SEEK_SET);
+        fputc(0, fp);
+        fclose(fp);
+    }
+    GridMap zero_cost;
+    cout << "TEST: Map File with Zero Cost " << (loadMapFile(file_name, zero_cost) ? "loaded" : "rejected") << endl;
+
+    // 큰 지도: 여는 시간은 파일 크기와 거의 관계없음 (접근하는 페이지만 읽음)
+    const int size = 8192;
+    GridMap large(size, size);
+    for (int x = 1; x < size; x += 2) {
+        for (int y = 0; y < size - 1; y++) large.setBlocked(x, (x / 2) % 2 ? y + 1 : y, true);
+    }
+    saveMapFile(file_name, large);
+
+    auto load_begin = chrono::steady_clock::now();
+    GridMap mapped;
+    bool loaded = loadMapFile(file_name, mapped);
+    auto load_end = chrono::steady_clock::now();
+    cout << "TEST: Map File " << size << " x " << size << (loaded ? " loaded" : " not loaded") << " in "
+         << chrono::duration<double, milli>(load_end - load_begin).count() << "ms" << endl;
+    remove(file_name);
+
+    // 시간 측정 종료
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/parallel_distance_field.h"
+#include "test_maps.h"
+
+using namespace std;
+
+// 빌드: g++ -std=c++17 -O2 -pthread ParallelDistance_TEST_algorithm.cpp
+// 스레드 수에 따른 시간 비교는 Benchmark/distance_scaling.cpp
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    // 결과 경로 출력용 벡터 (O: 미방문 노드, X: 방문한 노드, . : 경로)
+    vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+
+    GridMap map = GridMap::fromMaze(maze);
+    GridPlanner planner(map);
+    ParallelDistancePlanner parallel(map, 4);
+
+    // 4 스레드로 종점까지의 전체 거리 지도 계산
+    DistanceField field;
+    if(parallel.distanceField(tc.goal, field)){
+        vector<Point> path;
+        field.path(tc.start, path);
+        cout << "TEST: Parallel Distance Field (" << parallel.threadCount() << " threads)" << endl;
+        cout << "Number of Visited Node : " << parallel.visitCount() << ", Buckets : " << parallel.phaseCount() << endl;
+        cout << "Distance from start : " << field.distance(tc.start.x, tc.start.y) << ", Path Cost : " << path.size() << endl;
+
+        for(int i=0; i<(int)maze.size(); i++){
+            for(int j=0; j<(int)maze[0].size(); j++){
+                if(field.distance(i, j) != DistanceField::kUnreachable) res_map[i][j] = 'X';
+            }
+        }
+        for(auto p : path){
+            res_map[p.x][p.y] = '.';
+        }
+        for(auto row : res_map){
+            for(char c : row){
+                cout << c << " ";
+            }
+            cout << endl;
+        }
+    }
+    else{
+        cout << "Path Not Found" << endl;
+    }
+
+    // 다익스트라 거리 지도와 비교 (모든 셀의 거리가 같아야 함)
+    DistanceField dijkstra_field;
+    planner.distanceField(tc.goal, dijkstra_field);
+    int diff = 0;
+    for(int i=0; i<(int)maze.size(); i++){
+        for(int j=0; j<(int)maze[0].size(); j++){
+            diff += field.distance(i, j) != dijkstra_field.distance(i, j);
+        }
+    }
+    cout << "TEST: Different Distance (Parallel vs Dijkstra) : " << diff << endl;
+
+    // 1 스레드 결과와 비교 (다음 이동 셀까지 같아야 함)
+    ParallelDistancePlanner single(map, 1);
+    DistanceField single_field;
+    single.distanceField(tc.goal, single_field);
+    int next_diff = 0;
+    for(int i=0; i<(int)maze.size(); i++){
+        for(int j=0; j<(int)maze[0].size(); j++){
+            Point a, b;
+            bool ha = field.nextStep({i, j}, a), hb = single_field.nextStep({i, j}, b);
+            next_diff += ha != hb || (ha && (a.x != b.x || a.y != b.y));
+        }
+    }
+    cout << "TEST: Different Next Step (4 threads vs 1 thread) : " << next_diff << endl;
+
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
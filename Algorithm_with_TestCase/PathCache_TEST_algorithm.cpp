@@ -0,0 +1,100 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <chrono>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/path_cache.h"
+#include "test_maps.h"
+
+using namespace std;
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    GridMap map = GridMap::fromMaze(maze);
+    GridPlanner planner(map);
+    PathCache cache(map);
+
+    // 같은 요청 두 번: 처음은 탐색, 두 번째는 캐시
+    GridPath path;
+    cache.findPath(planner, tc.start, tc.goal, path);
+    cout << "TEST: First Query, Number of Visited Node : " << planner.visitCount() << ", Path Cost : " << path.size() << endl;
+    if(cache.findPath(planner, tc.start, tc.goal, path)){
+        cout << "TEST: Repeated Query, Cache Hits : " << cache.stats().hits << ", Path Cost : " << path.size() << endl;
+
+        // 결과 경로 출력용 벡터 (O: 이동 가능, X: 장애물, . : 캐시에서 복원한 경로)
+        vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+        for(int i=0; i<(int)maze.size(); i++){
+            for(int j=0; j<(int)maze[0].size(); j++){
+                if(maze[i][j] != 0) res_map[i][j] = 'X';
+            }
+        }
+        for(auto p : path){
+            res_map[p.x][p.y] = '.';
+        }
+        for(auto row : res_map){
+            for(char c : row){
+                cout << c << " ";
+            }
+            cout << endl;
+        }
+    }
+    else{
+        cout << "Path Not Found" << endl;
+    }
+    cout << "Hits : " << cache.stats().hits << ", Misses : " << cache.stats().misses << ", Cache Bytes : " << cache.bytes() << endl;
+
+    // 경로 위의 셀을 막으면 그 항목만 지워지고, 다음 요청은 새 지도에서 다시 탐색
+    Point middle = path[path.size() / 2];
+    map.setBlocked(middle.x, middle.y, true);
+    cache.invalidateCells({middle});
+    bool found = cache.findPath(planner, tc.start, tc.goal, path);
+    cout << "TEST: Path Cell Blocked, Invalidated : " << cache.stats().invalidated << ", Found : " << found
+         << ", Path Cost : " << (found ? (int)path.size() : -1) << ", Version : " << cache.version() << endl;
+    map.setBlocked(middle.x, middle.y, false);
+    cache.invalidateCells({middle});
+
+    // 큰 지도 (장애물 20%): 도크 4곳 -> 선반 16곳 요청을 반복
+    const int size = 1024;
+    GridMap large = randomObstacleMap(size, 0.2, 3);
+    vector<Point> docks, shelves;
+    for(int i=0; i<4; i++) docks.push_back({10 + i * 250, 5});
+    for(int i=0; i<16; i++) shelves.push_back({30 + (i / 4) * 250, 500 + (i % 4) * 150});
+    for(auto p : docks) large.setBlocked(p.x, p.y, false);
+    for(auto p : shelves) large.setBlocked(p.x, p.y, false);
+
+    GridPlanner large_planner(large);
+    PathCache large_cache(large);
+    const int rounds = 10;
+    double search_ms = 0, cached_ms = 0;
+    for(int r=0; r<rounds; r++){
+        for(auto d : docks){
+            for(auto s : shelves){
+                auto t0 = chrono::steady_clock::now();
+                large_planner.aStarAlgorithm(d, s, path);
+                auto t1 = chrono::steady_clock::now();
+                large_cache.findPath(large_planner, d, s, path);
+                auto t2 = chrono::steady_clock::now();
+                search_ms += chrono::duration<double, milli>(t1 - t0).count();
+                cached_ms += chrono::duration<double, milli>(t2 - t1).count();
+            }
+        }
+    }
+    cout << "TEST: " << size << " x " << size << " Repeated Queries : " << rounds * docks.size() * shelves.size()
+         << ", Astar : " << search_ms << "ms, With Cache : " << cached_ms << "ms, Hit Rate : " << large_cache.stats().hitRate()
+         << ", Cache Bytes : " << large_cache.bytes() << endl;
+
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
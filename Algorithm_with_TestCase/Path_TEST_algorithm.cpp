@@ -0,0 +1,90 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <utility>
+#include <ctime>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/grid_path.h"
+#include "test_maps.h"
+
+using namespace std;
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    // 결과 경로 출력용 벡터 (O: 미방문 노드, X: 방문한 노드, . : 경로)
+    vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+
+    GridMap map = GridMap::fromMaze(maze);
+    GridPlanner planner(map);
+
+    // 경로를 셀 인덱스 배열 (GridPath)로 받음
+    GridPath path;
+    if (planner.aStarAlgorithm(tc.start, tc.goal, path)) {
+        cout << "TEST: Astar(GridPath) Path Cost:" << path.size() << ", Visited Node:" << planner.visitCount() << endl;
+
+        for (int i = 0; i < (int)maze.size(); i++) {
+            for (int j = 0; j < (int)maze[0].size(); j++) {
+                if (planner.isVisited(i, j)) res_map[i][j] = 'X';
+            }
+        }
+        for (Point p : path) {
+            res_map[p.x][p.y] = '.';
+        }
+        for (auto row : res_map) {
+            for (char c : row) {
+                cout << c << " ";
+            }
+            cout << endl;
+        }
+    } else {
+        cout << "No path found." << endl;
+    }
+
+    // 방향 체인 인코딩 후 복원 (같은 경로여야 함)
+    CompactPath compact;
+    compact.encode(path);
+    GridPath decoded;
+    compact.decode(decoded);
+    cout << "TEST: CompactPath " << compact.chain().size() << " runs, " << compact.bytes() << " bytes (vector<Point> "
+         << path.size() * sizeof(Point) << " bytes), decoded " << (decoded.cells() == path.cells() ? "same" : "different") << endl;
+
+    // 큰 지도에서 경로 여러 개를 만들어 보관: 탐색 버퍼는 재사용하고, 보관하는 경로는 이동(move)만 함
+    const int size = 512, queries = 2000;
+    GridMap large(size, size);
+    mt19937 rng(1);
+    for (int i = 0; i < size * size / 5; i++) large.setBlocked(rng() % size, rng() % size, true);
+    GridPlanner large_planner(large);
+    uniform_int_distribution<int> coord(0, size - 1);
+
+    vector<CompactPath> stored;
+    size_t cells = 0, bytes = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int i = 0; i < queries; i++) {
+        Point s = {coord(rng), coord(rng)}, g = {coord(rng), coord(rng)};
+        if (!large_planner.aStarAlgorithm(s, g, path)) continue;
+        CompactPath encoded;
+        encoded.encode(path);
+        cells += encoded.size();
+        bytes += encoded.bytes();
+        stored.push_back(move(encoded));
+    }
+    auto t1 = chrono::steady_clock::now();
+    cout << "TEST: " << stored.size() << " paths stored, " << cells << " cells in " << bytes << " bytes (vector<Point> "
+         << cells * sizeof(Point) << " bytes), " << chrono::duration<double, milli>(t1 - t0).count() << "ms" << endl;
+
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
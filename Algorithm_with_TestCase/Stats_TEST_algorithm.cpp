@@ -0,0 +1,79 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+
+// 확장 순서 기록을 켜고 빌드 (search_stats.h)
+#define PLANNER_TRACE 1
+
+#include "../Algorithm/grid_planner.h"
+#include "test_maps.h"
+
+using namespace std;
+
+// 탐색 통계 출력
+void printStats(const string& name, const SearchStats& stats) {
+    cout << "TEST: " << name << " Stats" << endl;
+    cout << "Expanded:" << stats.expanded << ", Pushed:" << stats.pushed << ", Stale Pop:" << stats.stale_pops
+         << ", Peak Open:" << stats.peak_open << ", Bytes Allocated:" << stats.bytes_allocated << endl;
+    cout << "Setup:" << stats.setup_us << "us, Search:" << stats.search_us << "us, Path:" << stats.path_us << "us" << endl;
+}
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+
+    // 시간 측정 시작
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    GridMap map = GridMap::fromMaze(maze);
+    GridPlanner planner(map);
+    vector<Point> path;
+
+    // 첫 탐색은 openset/path 저장소를 할당하므로 Bytes Allocated가 0보다 큼
+    planner.aStarAlgorithm(tc.start, tc.goal, path, ManhattanHeuristic());
+    printStats("Astar(first query)", planner.stats());
+
+    // 같은 플래너로 다시 탐색하면 저장소를 재사용하므로 0
+    planner.aStarAlgorithm(tc.start, tc.goal, path, ManhattanHeuristic());
+    printStats("Astar", planner.stats());
+
+    // 확장 순서를 파일로 저장한 뒤 다시 읽어서 비교
+    const char* file_name = "astar_trace.bin";
+    SearchTrace loaded;
+    bool saved = planner.trace().save(file_name);
+    bool same = saved && loaded.load(file_name) && loaded.order() == planner.trace().order();
+    FILE* fp = fopen(file_name, "rb");
+    long file_size = 0;
+    if (fp) {
+        fseek(fp, 0, SEEK_END);
+        file_size = ftell(fp);
+        fclose(fp);
+    }
+    remove(file_name);
+    cout << "TEST: Trace " << planner.trace().order().size() << " cells, " << file_size << " bytes, "
+         << (same ? "reloaded" : "mismatch") << endl;
+
+    // 확장 순서 (처음 10개)
+    cout << "Expansion Order:";
+    for (int i = 0; i < 10 && i < (int)planner.trace().order().size(); i++) {
+        Point p = map.toPoint(planner.trace().order()[i]);
+        cout << " (" << p.x << "," << p.y << ")";
+    }
+    cout << endl;
+
+    planner.dijkstra(tc.start, tc.goal, path);
+    printStats("Dijkstra", planner.stats());
+
+    // 시간 측정 종료
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <chrono>
+
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/wavefront.h"
+#include "test_maps.h"
+
+using namespace std;
+
+int main() {
+    clock_t start_time, finish_time;
+    double duration;
+    start_time = clock();
+
+    // 테스트 지도 선택 (test_maps.h)
+    TestCase tc = testCase1();
+    // TestCase tc = testCase2();
+    vector<vector<int>>& maze = tc.maze;
+
+    // 결과 경로 출력용 벡터 (O: 미방문 노드, X: 방문한 노드, . : 경로)
+    vector<vector<char>> res_map(maze.size(), vector<char>(maze[0].size(), 'O'));
+
+    GridMap map = GridMap::fromMaze(maze);
+    GridPlanner planner(map);
+    WavefrontPlanner wavefront(map);
+
+    // 비트 병렬 wavefront로 종점까지의 전체 거리 지도 계산
+    DistanceField field;
+    if(wavefront.distanceField(tc.goal, field)){
+        vector<Point> path;
+        field.path(tc.start, path);
+        cout << "TEST: Wavefront Distance Field" << endl;
+        cout << "Number of Visited Node : " << wavefront.visitCount() << endl;
+        cout << "Distance from start : " << field.distance(tc.start.x, tc.start.y) << ", Path Cost : " << path.size() << endl;
+
+        for(int i=0; i<(int)maze.size(); i++){
+            for(int j=0; j<(int)maze[0].size(); j++){
+                if(field.distance(i, j) != DistanceField::kUnreachable) res_map[i][j] = 'X';
+            }
+        }
+        for(auto p : path){
+            res_map[p.x][p.y] = '.';
+        }
+        for(auto row : res_map){
+            for(char c : row){
+                cout << c << " ";
+            }
+            cout << endl;
+        }
+    }
+    else{
+        cout << "Path Not Found" << endl;
+    }
+
+    // 다익스트라 거리 지도와 비교 (모든 셀의 거리가 같아야 함)
+    DistanceField dijkstra_field;
+    planner.distanceField(tc.goal, dijkstra_field);
+    int diff = 0;
+    for(int i=0; i<(int)maze.size(); i++){
+        for(int j=0; j<(int)maze[0].size(); j++){
+            diff += field.distance(i, j) != dijkstra_field.distance(i, j);
+        }
+    }
+    cout << "TEST: Different Distance (Wavefront vs Dijkstra) : " << diff << endl;
+
+    // 큰 빈 지도: 다익스트라 (힙) vs wavefront (비트셋)
+    const int size = 2048;
+    GridMap large(size, size);
+    GridPlanner large_planner(large);
+    WavefrontPlanner large_wavefront(large);
+    Point center = {size / 2, size / 2};
+
+    auto t0 = chrono::steady_clock::now();
+    large_planner.distanceField(center, dijkstra_field);
+    auto t1 = chrono::steady_clock::now();
+    large_wavefront.distanceField(center, field);
+    auto t2 = chrono::steady_clock::now();
+    cout << "TEST: " << size << " x " << size << " Distance Field, Dijkstra : " << chrono::duration<double, milli>(t1 - t0).count()
+         << "ms, Wavefront : " << chrono::duration<double, milli>(t2 - t1).count() << "ms" << endl;
+
+    finish_time = clock();
+    duration = (finish_time - start_time);
+    cout << "Time: " << duration << "ms" << endl;
+
+    return 0;
+}
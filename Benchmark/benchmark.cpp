@@ -0,0 +1,238 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+#include <new>
+
+#include "../Algorithm/grid_map.h"
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/jps_planner.h"
+#include "../Algorithm/wavefront.h"
+#include "../Algorithm/anytime_planner.h"
+
+using namespace std;
+
+// 벤치마크
+// 생성한 지도 위에서 탐색 시간만 측정하여 CSV로 출력함. (지도 생성, 출력 시간은 제외)
+//
+// 빌드: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+// 실행: ./benchmark [--sizes 20,128,512,2048] [--densities 0,0.1,0.2,0.3] [--queries 50] [--seed 1]
+// 8192 x 8192는 기본 목록에 없음 (--sizes 20,512,8192 처럼 직접 지정). 지도 하나가 64M 셀이고
+// 다익스트라와 전체 거리 지도는 질의마다 지도 전체를 훑으므로, 기본 설정 (밀도 4개 x 50 질의)으로는 한 시간 넘게 걸림.
+//
+// 출력 열
+//   algorithm, size(한 변의 길이), density(장애물 비율), queries(측정한 탐색 수), found(경로를 찾은 수),
+//   p50_us / p90_us / p99_us / max_us (탐색 1회 지연 시간 백분위, 마이크로초),
+//   mean_expanded (탐색 1회 평균 확장 노드 수), allocs_per_query (탐색 1회 평균 heap 할당 횟수)
+
+// heap 할당 횟수 측정용 전역 operator new
+static size_t g_alloc_count = 0;
+
+void* operator new(size_t size) {
+    g_alloc_count++;
+    if (void* p = malloc(size == 0 ? 1 : size)) return p;
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+struct Options {
+    vector<int> sizes = {20, 128, 512, 2048};
+    vector<double> densities = {0.0, 0.1, 0.2, 0.3};
+    int queries = 50;
+    unsigned seed = 1;
+};
+
+// 탐색 1회의 결과
+struct Sample {
+    double us;        // 탐색 시간 (마이크로초)
+    int expanded;     // 확장한 노드 수
+    size_t allocs;    // heap 할당 횟수
+    bool found;
+};
+
+template <class T>
+vector<T> parseList(const string& text) {
+    vector<T> values;
+    stringstream ss(text);
+    string item;
+    while (getline(ss, item, ',')) {
+        stringstream is(item);
+        T v;
+        is >> v;
+        values.push_back(v);
+    }
+    return values;
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string key = argv[i], value = argv[i + 1];
+        if (key == "--sizes") opt.sizes = parseList<int>(value);
+        else if (key == "--densities") opt.densities = parseList<double>(value);
+        else if (key == "--queries") opt.queries = atoi(value.c_str());
+        else if (key == "--seed") opt.seed = strtoul(value.c_str(), nullptr, 10);
+        else cerr << "unknown option: " << key << endl;
+    }
+    if (opt.queries <= 0) {
+        cerr << "--queries must be at least 1" << endl;
+        exit(1);
+    }
+    return opt;
+}
+
+// size x size 지도에 density 비율로 장애물을 무작위 배치
+GridMap generateMap(int size, double density, mt19937& rng) {
+    GridMap map(size, size);
+    bernoulli_distribution blocked(density);
+    for (int x = 0; x < size; x++) {
+        for (int y = 0; y < size; y++) {
+            if (blocked(rng)) map.setBlocked(x, y, true);
+        }
+    }
+    return map;
+}
+
+// 이동 가능한 셀 중에서 무작위로 시점, 종점 쌍을 고름
+vector<pair<Point, Point>> generateQueries(const GridMap& map, int count, mt19937& rng) {
+    vector<pair<Point, Point>> queries;
+    uniform_int_distribution<int> rx(0, map.rows() - 1), ry(0, map.cols() - 1);
+    auto randomFree = [&]() {
+        while (true) {
+            Point p = {rx(rng), ry(rng)};
+            if (map.isFree(p.x, p.y)) return p;
+        }
+    };
+    for (int i = 0; i < count; i++) {
+        queries.push_back({randomFree(), randomFree()});
+    }
+    return queries;
+}
+
+double percentile(vector<double> values, double q) {
+    if (values.empty()) return 0;
+    sort(values.begin(), values.end());
+    size_t k = min(values.size() - 1, (size_t)(q * (values.size() - 1) + 0.5));
+    return values[k];
+}
+
+// 탐색 함수: (시점, 종점, path) -> {경로 발견 여부, 확장 노드 수}
+using SearchFn = function<pair<bool, int>(Point, Point, vector<Point>&)>;
+
+void runCase(const string& name, int size, double density, const vector<pair<Point, Point>>& queries, const SearchFn& search) {
+    vector<Point> path;
+    vector<Sample> samples;
+    samples.reserve(queries.size());
+
+    // 첫 탐색은 버퍼 준비용 (측정 제외)
+    search(queries[0].first, queries[0].second, path);
+
+    for (auto& q : queries) {
+        size_t alloc_before = g_alloc_count;
+        auto t0 = chrono::steady_clock::now();
+        pair<bool, int> result = search(q.first, q.second, path);
+        auto t1 = chrono::steady_clock::now();
+        samples.push_back({chrono::duration<double, micro>(t1 - t0).count(), result.second,
+                           g_alloc_count - alloc_before, result.first});
+    }
+
+    vector<double> times;
+    double expanded = 0, allocs = 0;
+    int found = 0;
+    for (auto& s : samples) {
+        times.push_back(s.us);
+        expanded += s.expanded;
+        allocs += s.allocs;
+        found += s.found;
+    }
+
+    cout << name << "," << size << "," << density << "," << samples.size() << "," << found << ","
+         << percentile(times, 0.5) << "," << percentile(times, 0.9) << "," << percentile(times, 0.99) << ","
+         << percentile(times, 1.0) << "," << expanded / samples.size() << "," << allocs / samples.size() << endl;
+}
+
+int main(int argc, char** argv) {
+    Options opt = parseOptions(argc, argv);
+    mt19937 rng(opt.seed);
+
+    cout << "algorithm,size,density,queries,found,p50_us,p90_us,p99_us,max_us,mean_expanded,allocs_per_query" << endl;
+
+    for (int size : opt.sizes) {
+        for (double density : opt.densities) {
+            GridMap map = generateMap(size, density, rng);
+            vector<pair<Point, Point>> queries = generateQueries(map, opt.queries, rng);
+
+            GridPlanner planner(map);
+            GridPlanner8 planner8(map);
+            BucketGridPlanner bucket_planner(map);
+            JpsPlanner4 jps(map);
+            WavefrontPlanner wavefront(map);
+            AnytimePlanner anytime(map);
+            DistanceField field;
+
+            runCase("astar_euclidean", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = planner.aStarAlgorithm(s, g, path, EuclideanHeuristic());
+                return make_pair(found, planner.visitCount());
+            });
+            runCase("astar_manhattan", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = planner.aStarAlgorithm(s, g, path, ManhattanHeuristic());
+                return make_pair(found, planner.visitCount());
+            });
+            runCase("astar8_octile", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = planner8.aStarAlgorithm(s, g, path, OctileHeuristic());
+                return make_pair(found, planner8.visitCount());
+            });
+            runCase("astar8_scaled_euclidean", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = planner8.aStarAlgorithm(s, g, path, ScaledEuclideanHeuristic());
+                return make_pair(found, planner8.visitCount());
+            });
+            runCase("astar_manhattan_bucket", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = bucket_planner.aStarAlgorithm(s, g, path, ManhattanHeuristic());
+                return make_pair(found, bucket_planner.visitCount());
+            });
+            runCase("jps4_manhattan", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = jps.jumpPointSearch(s, g, path, ManhattanHeuristic());
+                return make_pair(found, jps.visitCount());
+            });
+            runCase("dijkstra", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = planner.dijkstra(s, g, path);
+                return make_pair(found, planner.visitCount());
+            });
+            runCase("astar_manhattan_bidirectional", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = planner.bidirectionalAStar(s, g, path, ManhattanHeuristic());
+                return make_pair(found, planner.visitCount());
+            });
+            runCase("dijkstra_bidirectional", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = planner.bidirectionalDijkstra(s, g, path);
+                return make_pair(found, planner.visitCount());
+            });
+            runCase("weighted_astar_w2", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = anytime.weightedAStar(s, g, path, 2.0);
+                return make_pair(found, anytime.visitCount());
+            });
+            // ARA*: 탐색 1회 2000 확장 제한 안에서 가장 좋은 경로
+            runCase("ara_star_2000_expansions", size, density, queries, [&](Point s, Point g, vector<Point>& path) {
+                bool found = anytime.anytimeAStar(s, g, path, SearchBudget::expansions(2000));
+                return make_pair(found, anytime.visitCount());
+            });
+            // 전체 거리 지도 (종점만 사용)
+            runCase("distance_field_dijkstra", size, density, queries, [&](Point, Point g, vector<Point>&) {
+                bool found = planner.distanceField(g, field);
+                return make_pair(found, planner.visitCount());
+            });
+            runCase("distance_field_wavefront", size, density, queries, [&](Point, Point g, vector<Point>&) {
+                bool found = wavefront.distanceField(g, field);
+                return make_pair(found, wavefront.visitCount());
+            });
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+
+#include "../Algorithm/grid_map.h"
+#include "../Algorithm/grid_planner.h"
+#include "../Algorithm/parallel_distance_field.h"
+
+using namespace std;
+
+// 전체 거리 지도 스레드 수 확장성 벤치마크
+// 지도 하나의 DistanceField를 다익스트라 (1 스레드)와 ParallelDistancePlanner (1 ~ N 스레드)로 계산한 시간을 CSV로 출력함.
+// 모든 스레드 수의 거리 지도와 다음 이동 셀이 1 스레드 결과와 같은지도 확인함. (identical 열)
+//
+// 빌드: g++ -std=c++17 -O2 -pthread distance_scaling.cpp -o distance_scaling
+// 실행: ./distance_scaling [--size 4096] [--density 0.2] [--threads 1,2,4,8] [--repeats 3] [--seed 1]
+//
+// 출력 열
+//   algorithm, threads, size, density, best_ms (repeats번 중 최소 시간), speedup (1 스레드 대비), phases (버킷 수), identical
+
+struct Options {
+    int size = 4096;
+    double density = 0.2;
+    vector<int> threads;
+    int repeats = 3;
+    unsigned seed = 1;
+};
+
+Options parseOptions(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string key = argv[i], value = argv[i + 1];
+        if (key == "--size") opt.size = atoi(value.c_str());
+        else if (key == "--density") opt.density = atof(value.c_str());
+        else if (key == "--repeats") opt.repeats = atoi(value.c_str());
+        else if (key == "--seed") opt.seed = strtoul(value.c_str(), nullptr, 10);
+        else if (key == "--threads") {
+            stringstream ss(value);
+            string item;
+            while (getline(ss, item, ',')) opt.threads.push_back(atoi(item.c_str()));
+        } else cerr << "unknown option: " << key << endl;
+    }
+    // 기본: 1부터 하드웨어 스레드 수까지 2배씩
+    if (opt.threads.empty()) {
+        int hw = max(1u, thread::hardware_concurrency());
+        for (int t = 1; t < hw; t *= 2) opt.threads.push_back(t);
+        opt.threads.push_back(hw);
+    }
+    return opt;
+}
+
+// fn()을 repeats번 실행한 최소 시간 (ms)
+template <class F>
+double bestMs(int repeats, F&& fn) {
+    double best = 1e30;
+    for (int i = 0; i < repeats; i++) {
+        auto t0 = chrono::steady_clock::now();
+        fn();
+        auto t1 = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double, milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+bool sameField(const DistanceField& a, const DistanceField& b) {
+    for (int x = 0; x < a.rows(); x++) {
+        for (int y = 0; y < a.cols(); y++) {
+            if (a.distance(x, y) != b.distance(x, y)) return false;
+            Point na, nb;
+            bool ha = a.nextStep({x, y}, na), hb = b.nextStep({x, y}, nb);
+            if (ha != hb || (ha && (na.x != nb.x || na.y != nb.y))) return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options opt = parseOptions(argc, argv);
+    mt19937 rng(opt.seed);
+
+    GridMap map(opt.size, opt.size);
+    bernoulli_distribution blocked(opt.density);
+    for (int x = 0; x < opt.size; x++) {
+        for (int y = 0; y < opt.size; y++) {
+            if (blocked(rng)) map.setBlocked(x, y, true);
+        }
+    }
+    Point goal = {opt.size / 2, opt.size / 2};
+    map.setBlocked(goal.x, goal.y, false);
+
+    cout << "algorithm,threads,size,density,best_ms,speedup,phases,identical" << endl;
+
+    DistanceField field;
+    GridPlanner planner(map);
+    double dijkstra_ms = bestMs(opt.repeats, [&]() { planner.distanceField(goal, field); });
+    cout << "dijkstra,1," << opt.size << "," << opt.density << "," << dijkstra_ms << ",,," << endl;
+
+    DistanceField reference;
+    double base_ms = 0;
+    for (int threads : opt.threads) {
+        ParallelDistancePlanner parallel(map, threads);
+        double ms = bestMs(opt.repeats, [&]() { parallel.distanceField(goal, field); });
+        if (reference.empty()) {
+            reference = field;
+            base_ms = ms;
+        }
+        cout << "parallel," << parallel.threadCount() << "," << opt.size << "," << opt.density << "," << ms << ","
+             << base_ms / ms << "," << parallel.phaseCount() << "," << (sameField(reference, field) ? 1 : 0) << endl;
+    }
+
+    return 0;
+}
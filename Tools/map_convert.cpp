@@ -0,0 +1,151 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+#include "../Algorithm/grid_map.h"
+#include "../Algorithm/map_file.h"
+
+using namespace std;
+
+// 지도 변환 도구: 텍스트 / PGM 점유 격자 지도 -> 이진 지도 파일 (.gmap, map_file.h)
+//
+// 빌드: g++ -std=c++17 -O2 map_convert.cpp -o map_convert
+// 실행: ./map_convert <input> <output.gmap> [--threshold N]
+//
+// 입력 형식 (파일 내용으로 판단)
+//   PGM (P2 텍스트 / P5 이진): 값이 threshold 미만인 (어두운) 픽셀이 장애물. 기본 threshold는 maxval / 2
+//   MovingAI 벤치마크 지도 (첫 줄 "type ..."): '.', 'G', 'S'는 이동 가능, 그 외는 장애물
+//   텍스트 격자: 한 줄이 한 행, '0' 또는 '.'은 이동 가능, '1', '#' 등 다른 문자는 장애물.
+//               공백, 쉼표, 중괄호는 무시하므로 코드의 maze 리터럴 ({0, 1, 0},)을 그대로 붙여 넣어도 됨.
+
+// PGM 헤더의 다음 토큰 (# 주석 건너뜀)
+static bool readPgmToken(istream& in, string& token) {
+    while (in >> token) {
+        if (token[0] != '#') return true;
+        string rest;
+        getline(in, rest);
+    }
+    return false;
+}
+
+static bool loadPgm(istream& in, int threshold, GridMap& map) {
+    string magic, w, h, maxval;
+    if (!readPgmToken(in, magic) || !readPgmToken(in, w) || !readPgmToken(in, h) || !readPgmToken(in, maxval)) return false;
+    int cols = atoi(w.c_str()), rows = atoi(h.c_str()), max_value = atoi(maxval.c_str());
+    if (rows <= 0 || cols <= 0 || max_value <= 0 || max_value > 65535) return false;
+    if (threshold < 0) threshold = max_value / 2;
+
+    map = GridMap(rows, cols);
+    if (magic == "P5") {
+        in.get();   // 헤더 뒤 공백 1 byte
+        int bytes = max_value < 256 ? 1 : 2;
+        vector<unsigned char> row(cols * bytes);
+        for (int x = 0; x < rows; x++) {
+            if (!in.read((char*)row.data(), row.size())) return false;
+            for (int y = 0; y < cols; y++) {
+                int v = bytes == 1 ? row[y] : (row[2 * y] << 8 | row[2 * y + 1]);
+                map.setBlocked(x, y, v < threshold);
+            }
+        }
+    } else if (magic == "P2") {
+        for (int x = 0; x < rows; x++) {
+            for (int y = 0; y < cols; y++) {
+                int v;
+                if (!(in >> v)) return false;
+                map.setBlocked(x, y, v < threshold);
+            }
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool loadMovingAi(istream& in, GridMap& map) {
+    string key, line;
+    int rows = -1, cols = -1;
+    while (in >> key && key != "map") {
+        if (key == "height") in >> rows;
+        else if (key == "width") in >> cols;
+        else getline(in, line);
+    }
+    if (rows <= 0 || cols <= 0) return false;
+    getline(in, line);
+
+    map = GridMap(rows, cols);
+    for (int x = 0; x < rows; x++) {
+        if (!getline(in, line) || (int)line.size() < cols) return false;
+        for (int y = 0; y < cols; y++) {
+            char c = line[y];
+            map.setBlocked(x, y, !(c == '.' || c == 'G' || c == 'S'));
+        }
+    }
+    return true;
+}
+
+static bool loadText(istream& in, GridMap& map) {
+    vector<vector<int>> maze;
+    string line;
+    while (getline(in, line)) {
+        vector<int> row;
+        for (char c : line) {
+            if (c == ' ' || c == '\t' || c == '\r' || c == ',' || c == '{' || c == '}' || c == ';') continue;
+            row.push_back(c == '0' || c == '.' ? 0 : 1);
+        }
+        if (row.empty()) continue;
+        if (!maze.empty() && row.size() != maze[0].size()) return false;
+        maze.push_back(row);
+    }
+    if (maze.empty()) return false;
+    map = GridMap::fromMaze(maze);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        cerr << "usage: " << argv[0] << " <input (.txt | .map | .pgm)> <output.gmap> [--threshold N]" << endl;
+        return 1;
+    }
+    int threshold = -1;
+    for (int i = 3; i + 1 < argc; i += 2) {
+        string key = argv[i];
+        if (key == "--threshold") threshold = atoi(argv[i + 1]);
+        else cerr << "unknown option: " << key << endl;
+    }
+
+    ifstream in(argv[1], ios::binary);
+    if (!in) {
+        cerr << "cannot open " << argv[1] << endl;
+        return 1;
+    }
+
+    // 첫 토큰으로 형식 판단
+    string first;
+    in >> first;
+    in.seekg(0);
+
+    GridMap map;
+    bool ok;
+    if (first == "P2" || first == "P5") ok = loadPgm(in, threshold, map);
+    else if (first == "type") ok = loadMovingAi(in, map);
+    else ok = loadText(in, map);
+
+    if (!ok) {
+        cerr << "invalid map: " << argv[1] << endl;
+        return 1;
+    }
+    if (!saveMapFile(argv[2], map)) {
+        cerr << "cannot write " << argv[2] << endl;
+        return 1;
+    }
+
+    int blocked = 0;
+    for (int x = 0; x < map.rows(); x++) {
+        for (int y = 0; y < map.cols(); y++) blocked += !map.isFree(x, y);
+    }
+    cout << argv[2] << ": " << map.rows() << " x " << map.cols() << ", blocked " << blocked << endl;
+    return 0;
+}